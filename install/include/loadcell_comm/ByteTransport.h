@@ -0,0 +1,48 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// read()가 데이터를 반환한 시각 (0이면 미기록)
+struct ReadTimestamp {
+    int64_t monotonic_ns = 0;  // CLOCK_MONOTONIC
+    int64_t realtime_ns = 0;   // CLOCK_REALTIME (SerialConfig::capture_realtime)
+};
+
+// 바이트 스트림 전송 계층 인터페이스
+// - SerialPort: 실제 tty
+// - CaptureTap: 다른 transport를 감싸 수신 chunk를 캡처 파일로 기록
+// - ReplayTransport: 캡처 파일 재생
+class ByteTransport {
+public:
+    virtual ~ByteTransport() = default;
+
+    virtual bool Open() = 0;
+    virtual void Close() noexcept = 0;
+    virtual bool IsOpen() const noexcept = 0;
+
+    // 반환: 읽은 바이트 수, 수신 데이터 없음/타임아웃 시 0, 오류 시 -1
+    virtual long Read(uint8_t* buf, std::size_t len) noexcept = 0;
+    virtual long ReadUntil(uint8_t* buf, std::size_t len,
+                           std::chrono::steady_clock::time_point deadline) noexcept = 0;
+    // 반환: 쓴 바이트 수, 송신 버퍼가 가득 차 쓰지 못하면 0 (non-blocking), 오류 시 -1
+    virtual long Write(const uint8_t* buf, std::size_t len) noexcept = 0;
+
+    long ReadFor(uint8_t* buf, std::size_t len, std::chrono::microseconds timeout) noexcept {
+        return ReadUntil(buf, len, std::chrono::steady_clock::now() + timeout);
+    }
+
+    // epoll/poll 등록 가능한 fd (없으면 -1)
+    virtual int Fd() const noexcept { return -1; }
+
+    // 1바이트 전송 시간(ns), 알 수 없으면 0
+    virtual int64_t ByteDurationNs() const noexcept { return 0; }
+
+    // 마지막으로 데이터를 읽은 Read() 반환 시각
+    virtual const ReadTimestamp& LastReadTime() const noexcept = 0;
+    // LastReadTime()이 이번 실행의 실제 read 시각인지 (캡처 당시 시각을 재생하면 false)
+    virtual bool LiveTimestamps() const noexcept { return true; }
+    virtual const std::string& LastError() const noexcept = 0;
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+// 원시 수신 chunk 캡처 파일 포맷 (host byte order, little-endian 전제)
+//
+//   CaptureFileHeader
+//   { CaptureChunkHeader, uint8_t data[size] } * N
+//
+// chunk는 read() 1회가 반환한 바이트와 그 반환 시각(CLOCK_MONOTONIC)을 그대로 기록한다.
+namespace capture_format {
+constexpr char kMagic[8] = {'L', 'C', 'C', 'A', 'P', 'T', 'R', '\0'};
+constexpr uint32_t kVersion = 1;
+
+struct CaptureFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_duration_ns;   // 캡처 당시 1바이트 전송 시간 (0: 알 수 없음)
+    int64_t start_realtime_ns;   // 캡처 시작 CLOCK_REALTIME (참고용)
+};
+
+struct CaptureChunkHeader {
+    int64_t monotonic_ns;        // read() 반환 시각
+    uint32_t size;               // 뒤따르는 데이터 바이트 수
+    uint32_t reserved;
+};
+
+static_assert(sizeof(CaptureFileHeader) == 24, "CaptureFileHeader layout");
+static_assert(sizeof(CaptureChunkHeader) == 16, "CaptureChunkHeader layout");
+} // namespace capture_format
@@ -0,0 +1,47 @@
+#pragma once
+#include "ByteTransport.h"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+// 다른 transport를 감싸 수신한 chunk를 캡처 파일(CaptureFormat.h)로 기록하는 tap
+// - Read/ReadUntil 결과는 그대로 전달 (동작 변경 없음)
+// - 파일 기록 실패 시 캡처만 중단되고 수신은 계속됨 (CaptureError()로 확인)
+class CaptureTap : public ByteTransport {
+public:
+    CaptureTap(std::unique_ptr<ByteTransport> inner, std::string capture_path);
+    ~CaptureTap() override;
+
+    CaptureTap(const CaptureTap&) = delete;
+    CaptureTap& operator=(const CaptureTap&) = delete;
+
+    // inner transport를 열고 캡처 파일 생성 (기존 파일은 덮어씀)
+    bool Open() override;
+    void Close() noexcept override;
+    bool IsOpen() const noexcept override { return inner_->IsOpen(); }
+
+    long Read(uint8_t* buf, std::size_t len) noexcept override;
+    long ReadUntil(uint8_t* buf, std::size_t len,
+                   std::chrono::steady_clock::time_point deadline) noexcept override;
+    long Write(const uint8_t* buf, std::size_t len) noexcept override;
+
+    int Fd() const noexcept override { return inner_->Fd(); }
+    int64_t ByteDurationNs() const noexcept override { return inner_->ByteDurationNs(); }
+    const ReadTimestamp& LastReadTime() const noexcept override { return inner_->LastReadTime(); }
+    bool LiveTimestamps() const noexcept override { return inner_->LiveTimestamps(); }
+    const std::string& LastError() const noexcept override;
+
+    ByteTransport& Inner() noexcept { return *inner_; }
+    const std::string& CaptureError() const noexcept { return capture_error_; }
+
+private:
+    void Record_(const uint8_t* buf, long read_bytes) noexcept;
+
+private:
+    std::unique_ptr<ByteTransport> inner_;
+    std::string capture_path_;
+    std::FILE* file_ = nullptr;
+    std::string last_error_;
+    std::string capture_error_;
+};
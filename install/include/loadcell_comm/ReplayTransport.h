@@ -0,0 +1,70 @@
+#pragma once
+#include "ByteTransport.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+enum class ReplayTiming {
+    kOriginal,          // 캡처 당시 chunk 간 시간 간격을 재현 (sleep)
+    kAsFastAsPossible   // 대기 없이 연속 재생 (오프라인 처리량 측정용)
+};
+
+// 캡처 파일(CaptureFormat.h) 재생 transport
+// - 파일은 mmap(read-only)으로 매핑하여 복사 없이 순차 재생
+// - LastReadTime(): kOriginal은 실제 재생 시각, kAsFastAsPossible은 캡처된 시각 (LiveTimestamps() == false)
+// - 파일 끝에 도달하면 Read()는 0 반환 (IsEof() == true)
+// - Write()는 지원하지 않음 (-1)
+class ReplayTransport : public ByteTransport {
+public:
+    explicit ReplayTransport(std::string capture_path,
+                             ReplayTiming timing = ReplayTiming::kAsFastAsPossible);
+    ~ReplayTransport() override;
+
+    ReplayTransport(const ReplayTransport&) = delete;
+    ReplayTransport& operator=(const ReplayTransport&) = delete;
+
+    bool Open() override;
+    void Close() noexcept override;
+    bool IsOpen() const noexcept override { return data_ != nullptr; }
+
+    long Read(uint8_t* buf, std::size_t len) noexcept override;
+    long ReadUntil(uint8_t* buf, std::size_t len,
+                   std::chrono::steady_clock::time_point deadline) noexcept override;
+    long Write(const uint8_t* buf, std::size_t len) noexcept override;
+
+    int64_t ByteDurationNs() const noexcept override { return byte_duration_ns_; }
+    const ReadTimestamp& LastReadTime() const noexcept override { return last_read_time_; }
+    bool LiveTimestamps() const noexcept override { return timing_ == ReplayTiming::kOriginal; }
+    const std::string& LastError() const noexcept override { return last_error_; }
+
+    bool IsEof() const noexcept;
+    // 처음 chunk부터 다시 재생 (kOriginal 기준 시각도 재설정)
+    void Rewind() noexcept;
+
+private:
+    // 현재 chunk 헤더를 읽어 chunk_data_/chunk_remain_ 설정, 파일 끝이면 false
+    bool LoadChunk_() noexcept;
+    std::chrono::steady_clock::time_point DueTime_() const noexcept;
+    long CopyChunk_(uint8_t* buf, std::size_t len) noexcept;
+
+private:
+    std::string capture_path_;
+    ReplayTiming timing_;
+
+    const uint8_t* data_ = nullptr;
+    std::size_t size_ = 0;
+    std::size_t offset_ = 0;            // 다음 chunk 헤더 위치
+
+    const uint8_t* chunk_data_ = nullptr;
+    std::size_t chunk_remain_ = 0;
+    int64_t chunk_monotonic_ns_ = 0;
+
+    int64_t first_monotonic_ns_ = 0;
+    std::chrono::steady_clock::time_point replay_start_{};
+    int64_t byte_duration_ns_ = 0;
+
+    ReadTimestamp last_read_time_;
+    std::string last_error_;
+};
@@ -0,0 +1,91 @@
+#ifndef LOADCELL_ACQUISITION_H_
+#define LOADCELL_ACQUISITION_H_
+
+#include "loadcell_stats.h"
+#include "loadcell_status.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+struct SerialConfig;
+template <typename T> class SpscQueue;
+
+namespace loadcell_comm {
+class LoadCell485;
+class LoadCellFilter;
+struct FilterChainConfig;
+template <typename T> class SeqLockSlot;
+
+// 전용 수신 스레드가 포트를 소유하고 디코딩된 프레임을
+// - lock-free SPSC 큐 (모든 프레임, 소비자 1개)
+// - seqlock 최신값 슬롯 (최신 프레임, 다중 reader)
+// 으로 배포한다.
+class LoadCellAcquisition {
+public:
+  static constexpr std::size_t kDefaultQueueFrames = 1024;
+
+  explicit LoadCellAcquisition(std::size_t queue_frames = kDefaultQueueFrames);
+  ~LoadCellAcquisition();
+
+    LoadCellAcquisition(const LoadCellAcquisition &) = delete;
+    LoadCellAcquisition &operator=(const LoadCellAcquisition &) = delete;
+
+    // 수신 스레드에서 무게 필터 적용 (큐/최신값에는 필터 출력이 들어감)
+    // Start() 전에 호출, 동작 중이면 false
+    bool SetFilter(const FilterChainConfig &cfg);
+    void ClearFilter() noexcept;
+    // 최신 프레임 기준 gross 안정 여부 (필터 미설정 시 false)
+    bool IsStable() const noexcept;
+
+    // 포트를 열고 수신 스레드 시작
+    // Stop() 응답성을 위해 cfg.vmin은 0으로, vtime_ds는 최소 1로, non_blocking은 false로 보정됨
+    // 이전 실행에서 큐에 남은 프레임은 버림 (소비자가 PopFrame 중이 아닐 때 호출)
+    bool Start(const SerialConfig &cfg);
+    // 수신 스레드 종료 후 포트 닫기 (최대 vtime_ds만큼 대기)
+    void Stop() noexcept;
+    // 수신 스레드 동작 여부 (read 오류 발생 시 스레드는 스스로 종료)
+    bool IsRunning() const noexcept;
+
+    // 소비자 스레드 1개 전용: 큐에서 프레임 꺼내기
+    bool PopFrame(LoadCellStatus &out_status) noexcept;
+    std::size_t PopFrames(LoadCellStatus *out_status, std::size_t capacity) noexcept;
+
+    // 임의 스레드: 최신 프레임 조회 (lock/블로킹 없음)
+    // 아직 수신된 프레임이 없으면 false, out_sequence는 누적 프레임 번호
+    bool LatestStatus(LoadCellStatus &out_status,
+                      uint64_t *out_sequence = nullptr) const noexcept;
+
+    // 큐가 가득 차 버려진 프레임 수 (최신값 슬롯에는 반영됨)
+    uint64_t DroppedFrames() const noexcept;
+
+    // 수신 스레드의 LoadCell485 통계 (임의 스레드)
+    LoadCellStats GetStats() const noexcept;
+
+    // Start() 실패 또는 수신 스레드 read 오류의 결과 (없으면 kOk)
+    ResultCode GetLastErrorCode() const noexcept;
+    // 수신 스레드가 멈춘 뒤에만 유효 (메시지는 호출 시 생성)
+    const std::string &GetLastError() const noexcept;
+
+private:
+    void RunLoop_() noexcept;
+
+private:
+    std::unique_ptr<LoadCell485> loadcell_;
+    std::unique_ptr<SpscQueue<LoadCellStatus>> queue_;
+    std::unique_ptr<SeqLockSlot<LoadCellStatus>> latest_;
+    std::unique_ptr<LoadCellFilter> filter_;
+
+    std::thread worker_;
+    std::atomic<bool> stop_requested_{false};
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> dropped_frames_{0};
+    std::atomic<bool> stable_{false};
+    // 수신 스레드는 오류 종류만 기록, 메시지는 GetLastError()에서 loadcell_로부터 생성
+    std::atomic<ResultCode> last_error_code_{ResultCode::kOk};
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_ACQUISITION_H_
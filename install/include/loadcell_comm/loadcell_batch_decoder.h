@@ -0,0 +1,57 @@
+#ifndef LOADCELL_BATCH_DECODER_H_
+#define LOADCELL_BATCH_DECODER_H_
+
+#include "loadcell_record.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace loadcell_comm {
+// 기본 로드셀 프레임(LoadCellFrameLayout, 25 bytes) 배치 디코더
+// - 입력: 헤더 검증이 끝난 프레임이 25 bytes 간격으로 연속 배치된 배열
+// - 출력: 열 지향(SoA) 배열 → 열 단위 분석(numpy/Arrow 등)에 복사 없이 전달
+// - kSsse3: 무게는 프레임 4개씩 pshufb로 big-endian 변환 후 4x4 전치,
+//           상태는 프레임 16개씩 16x16 byte 전치 (x86, 런타임 CPU 판별)
+// - kScalar: 프레임 단위 변환 (기준 구현, FrameParser::ApplyScale과 동일 결과)
+enum class DecodeBackend { kScalar, kSsse3 };
+
+// 출력 열 (호출자 소유, 각 열은 최소 count개), nullptr인 열은 생략
+struct FrameColumns {
+  // 무게 raw count (보정 전)
+  int32_t *gross_raw = nullptr;
+  int32_t *right_raw = nullptr;
+  int32_t *left_raw = nullptr;
+
+  // 보정 적용 무게 (double로 계산 후 float 변환 → Calibration::Apply 결과의 float 변환과 동일)
+  float *gross_weight = nullptr;
+  float *right_weight = nullptr;
+  float *left_weight = nullptr;
+
+  // 상태 바이트
+  uint8_t *right_battery_percent = nullptr;
+  uint8_t *right_charge_status = nullptr;
+  uint8_t *right_online_status = nullptr;
+  uint8_t *left_battery_percent = nullptr;
+  uint8_t *left_charge_status = nullptr;
+  uint8_t *left_online_status = nullptr;
+  uint8_t *gross_net_mark = nullptr;
+  uint8_t *overload_mark = nullptr;
+  uint8_t *out_of_tolerance_mark = nullptr;
+};
+
+// 자동 선택된 구현으로 frames[0..count) 디코딩
+// calibration은 float 무게 열에만 적용 (기본: 항등)
+void DecodeFrameBatch(const uint8_t *frames, std::size_t count, const FrameColumns &out,
+                      const Calibration &calibration = Calibration()) noexcept;
+
+// 지정한 구현으로 디코딩 (미지원 구현은 kScalar로 대체)
+void DecodeFrameBatchWith(DecodeBackend backend, const uint8_t *frames, std::size_t count,
+                          const FrameColumns &out,
+                          const Calibration &calibration = Calibration()) noexcept;
+
+bool IsDecodeBackendSupported(DecodeBackend backend) noexcept;
+// DecodeFrameBatch가 사용하는 구현
+DecodeBackend ActiveDecodeBackend() noexcept;
+const char *DecodeBackendName(DecodeBackend backend) noexcept;
+} // namespace loadcell_comm
+
+#endif // LOADCELL_BATCH_DECODER_H_
@@ -0,0 +1,123 @@
+#ifndef LOADCELL_BUS_H_
+#define LOADCELL_BUS_H_
+
+#include "loadcell_status.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct SerialConfig;
+class ByteTransport;
+
+namespace loadcell_comm {
+class FrameParser;
+
+// 요청 명령 (실제 명령 바이트로의 변환은 BusConfig::encoder가 담당)
+enum class BusCommand : uint8_t {
+  kPoll = 0x00,         // 상태 프레임 요청
+  kTare = 0x01,         // 용기 무게 설정
+  kZero = 0x02,         // 영점 설정
+  kAddressQuery = 0x03, // 주소 응답 확인
+};
+
+// 요청 프레임 인코더: out에 요청을 쓰고 길이 반환 (지원하지 않는 명령, capacity 부족 시 0)
+// 0 또는 capacity 초과 반환은 설정 오류로 보고 송신하지 않음 (kInvalidArgument)
+// 요청은 응답 헤더(0x55 0xAB ...)로 시작하지 않아야 함 (RS-485 로컬 에코를 응답으로 오인)
+using BusRequestEncoder = std::size_t (*)(uint8_t address, BusCommand command,
+                                          uint8_t *out, std::size_t capacity) noexcept;
+
+struct BusConfig {
+  // 요청 송신 전 버스 유휴 시간 (문자 수, Modbus RTU 기준 3.5)
+  double inter_frame_gap_chars = 3.5;
+  // 장치 매뉴얼의 요청 형식 (필수, 기본 형식 없음)
+  // 미설정이면 Open()은 false, Transact()/PollCycle()/ScanAddresses()는 송신하지 않음
+  BusRequestEncoder encoder = nullptr;
+};
+
+struct BusDeviceConfig {
+  uint8_t address = 0x01; // 응답 헤더 3번째 바이트 (0x55 불가)
+  // 요청 송신 완료 ~ 응답 프레임 수신 완료까지 허용 시간 (응답 전송 시간 별도 가산)
+  std::chrono::microseconds response_timeout{20000};
+  unsigned retries = 2; // 타임아웃 시 재전송 횟수
+};
+
+struct BusDeviceStats {
+  uint64_t requests = 0;  // 송신한 요청 수 (재전송 포함)
+  uint64_t responses = 0; // 수신한 응답 프레임 수
+  uint64_t timeouts = 0;  // 응답 대기 타임아웃 수
+  uint64_t failures = 0;  // 재시도 후에도 실패한 트랜잭션 수
+};
+
+// RS-485 멀티드롭 버스 마스터 (단일 스레드)
+// - 등록된 주소에 요청 → 해당 주소 헤더(0x55 0xAB address)의 응답 프레임 수신
+// - 반이중 버스이므로 미응답 요청은 항상 1개, 응답 직후 inter-frame gap만 두고 다음 요청 송신
+// - 장치별 응답 타임아웃/재시도
+class LoadCellBus {
+public:
+  using ResultCallback =
+      std::function<void(uint8_t address, ResultCode rc, const LoadCellStatus &status)>;
+
+  // SerialPort 사용
+  explicit LoadCellBus(const BusConfig &bus_cfg = BusConfig{});
+  LoadCellBus(std::unique_ptr<ByteTransport> transport, const BusConfig &bus_cfg = BusConfig{});
+  ~LoadCellBus();
+
+    LoadCellBus(const LoadCellBus &) = delete;
+    LoadCellBus &operator=(const LoadCellBus &) = delete;
+
+    // cfg.non_blocking은 true로, vmin/vtime_ds는 0으로 보정됨 (transport가 SerialPort일 때만)
+    bool Open(const SerialConfig &cfg);
+    // 이미 구성된 transport 열기 (non-blocking ReadUntil 지원 필요)
+    bool Open();
+    void Close() noexcept;
+    bool IsOpen() const noexcept;
+
+    bool AddDevice(const BusDeviceConfig &cfg);
+    bool RemoveDevice(uint8_t address);
+    std::size_t DeviceCount() const noexcept;
+    bool GetDeviceStats(uint8_t address, BusDeviceStats &out_stats) const noexcept;
+
+    // 요청 1개 송신 후 응답 대기 (재시도 포함)
+    // kOk: 응답 프레임 디코딩, kTimeout: 재시도 후에도 응답 없음 (송신 큐 정체 포함),
+    // kIoReadFail: 송수신 오류, kInvalidArgument: 등록되지 않은 주소, encoder 미설정 또는 인코딩 실패
+    ResultCode Transact(uint8_t address, BusCommand command, LoadCellStatus &out_status);
+
+    // 등록된 모든 장치를 등록 순서대로 1회 poll, 장치마다 callback 호출 (rc != kOk면 status 무효)
+    // 반환: 응답을 받은 장치 수, 송수신 오류 또는 encoder 미설정/인코딩 실패 시 -1 (남은 장치는 건너뜀)
+    int PollCycle(const ResultCallback &callback);
+
+    // first~last 주소에 kAddressQuery를 보내 응답한 주소 목록 반환 (등록 여부 무관, 재시도 없음)
+    // 송수신 오류나 인코딩 실패 시 그때까지의 목록으로 중단, GetLastError()가 비어 있지 않음
+    std::vector<uint8_t> ScanAddresses(uint8_t first, uint8_t last,
+                                       std::chrono::microseconds timeout);
+
+    // 요청 간 최소 간격 (inter_frame_gap_chars × 1바이트 전송 시간)
+    std::chrono::nanoseconds InterFrameGap() const noexcept;
+
+    const std::string &GetLastError() const noexcept;
+
+private:
+    struct Device;
+
+    Device *FindDevice_(uint8_t address) noexcept;
+    ResultCode Attempt_(Device &device, BusCommand command,
+                        std::chrono::microseconds timeout, LoadCellStatus &out_status);
+    bool HasEncoder_();
+    ResultCode WriteAll_(const uint8_t *data, std::size_t size,
+                         std::chrono::steady_clock::time_point deadline);
+
+private:
+    std::unique_ptr<ByteTransport> transport_;
+    BusConfig bus_cfg_;
+    std::vector<std::unique_ptr<Device>> devices_;
+    // 마지막 버스 활동(응답 수신/타임아웃) 시각, 다음 요청은 여기에 gap을 더한 뒤 송신
+    std::chrono::steady_clock::time_point bus_idle_since_{};
+    std::string last_error_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_BUS_H_
@@ -0,0 +1,196 @@
+#ifndef LOADCELL_CORO_H_
+#define LOADCELL_CORO_H_
+
+// C++20 코루틴 수신 API (loadcell_comm_coro 타깃, C++20 컴파일러에서만 빌드)
+// - LoadCellReactor: 단일 스레드 epoll 이벤트 루프, fd 수신 가능/기한 초과/취소 시 코루틴 재개
+// - NextFrame()/NextBatch(): LoadCell485 위의 awaitable
+// - 포트는 non_blocking 모드로 열어야 함 (SerialConfig::non_blocking)
+
+#include "loadcell_485.h"
+#include "loadcell_status.h"
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <vector>
+
+namespace loadcell_comm {
+class LoadCellReactor;
+
+enum class AwaitResult {
+  kOk,         // 프레임 수신
+  kTimeout,    // 기한 내 프레임 없음
+  kCancelled,  // CancelToken::Cancel()
+  kIoReadFail, // read 오류/장치 분리 (원인은 LoadCell485::GetLastError)
+};
+
+// 대기 취소 (임의 스레드에서 Cancel 호출 가능)
+// 한 번 취소되면 이후 이 토큰으로 시작하는 대기는 즉시 kCancelled
+class CancelToken {
+public:
+  CancelToken() = default;
+  CancelToken(const CancelToken &) = delete;
+  CancelToken &operator=(const CancelToken &) = delete;
+
+    void Cancel() noexcept;
+    bool IsCancelled() const noexcept { return cancelled_.load(std::memory_order_acquire); }
+    // 재사용 (대기 중이 아닐 때만)
+    void Reset() noexcept { cancelled_.store(false, std::memory_order_release); }
+
+private:
+    friend class LoadCellReactor;
+
+    std::atomic<bool> cancelled_{false};
+    std::atomic<LoadCellReactor *> reactor_{nullptr};
+};
+
+// 즉시 시작하고 완료 시 스스로 해제되는 코루틴 반환 타입
+// 예외가 코루틴 밖으로 나오면 std::terminate
+struct CoroTask {
+  struct promise_type {
+    CoroTask get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+namespace coro_detail {
+// reactor에 등록되는 대기 항목 (awaiter가 상속)
+class Waiter {
+public:
+  Waiter() = default;
+  virtual ~Waiter() = default;
+
+    // reactor에 주소가 등록되므로 복사/이동 불가
+    Waiter(const Waiter &) = delete;
+    Waiter &operator=(const Waiter &) = delete;
+
+    // fd 수신 가능 (hang_up: EPOLLHUP/EPOLLERR 동반)
+    // 반환: true면 결과가 정해졌으므로 대기 종료(코루틴 재개), false면 다시 fd 대기
+    virtual bool OnReadable(bool hang_up) noexcept = 0;
+    // 기한 초과/취소 등 reactor가 결과를 정함
+    virtual void Complete(AwaitResult result) noexcept = 0;
+
+    LoadCellReactor *reactor = nullptr;
+    int fd = -1;
+    std::chrono::steady_clock::time_point deadline{};
+    CancelToken *token = nullptr;
+    std::coroutine_handle<> handle{};
+    bool registered = false;
+};
+}  // namespace coro_detail
+
+class LoadCellReactor {
+public:
+  // epoll/eventfd 생성 실패 시 std::runtime_error
+  LoadCellReactor();
+  ~LoadCellReactor();
+
+    LoadCellReactor(const LoadCellReactor &) = delete;
+    LoadCellReactor &operator=(const LoadCellReactor &) = delete;
+
+    // 이벤트 1회 처리 (timeout: 음수면 대기 항목/Stop까지 무한 대기)
+    // 반환: 재개한 코루틴 수, 오류 시 -1
+    int RunOnce(std::chrono::microseconds timeout);
+    // Stop() 호출 또는 대기 항목이 모두 없어질 때까지 반복
+    // Run() 시작 전에 호출된 Stop()도 적용되어 즉시 반환
+    bool Run();
+    // 임의 스레드에서 호출 가능
+    void Stop() noexcept;
+    // 임의 스레드에서 호출 가능, 대기 중인 RunOnce를 깨움
+    void Wake() noexcept;
+
+    std::size_t PendingCount() const noexcept { return waiters_.size(); }
+    const std::string &GetLastError() const noexcept { return last_error_; }
+
+    // awaiter 전용
+    bool Register_(coro_detail::Waiter &waiter) noexcept;
+    bool Rearm_(coro_detail::Waiter &waiter) noexcept;
+    void Unregister_(coro_detail::Waiter &waiter) noexcept;
+
+private:
+    void Resume_(coro_detail::Waiter &waiter) noexcept;
+    int ExpireAndCancel_() noexcept;
+    void DetachToken_(CancelToken &token) noexcept;
+
+private:
+    int epoll_fd_ = -1;
+    int wake_fd_ = -1;
+    std::atomic<bool> stop_requested_{false};
+    std::vector<coro_detail::Waiter *> waiters_;
+    std::string last_error_;
+};
+
+// co_await NextFrame(reactor, loadcell, status, timeout[, &token]) → AwaitResult
+class NextFrameAwaiter : public coro_detail::Waiter {
+public:
+  NextFrameAwaiter(LoadCellReactor &reactor, LoadCell485 &loadcell,
+                   LoadCellStatus &out_status, std::chrono::microseconds timeout,
+                   CancelToken *token) noexcept;
+  ~NextFrameAwaiter() override;
+
+    bool await_ready() noexcept;
+    bool await_suspend(std::coroutine_handle<> handle) noexcept;
+    AwaitResult await_resume() const noexcept { return result_; }
+
+    bool OnReadable(bool hang_up) noexcept override;
+    void Complete(AwaitResult result) noexcept override { result_ = result; }
+
+private:
+    bool TryReceive_() noexcept;
+
+    LoadCell485 &loadcell_;
+    LoadCellStatus &out_status_;
+    std::chrono::microseconds timeout_;
+    AwaitResult result_ = AwaitResult::kTimeout;
+};
+
+// co_await NextBatch(...) → AwaitResult, kOk이면 out_count ≥ 1
+class NextBatchAwaiter : public coro_detail::Waiter {
+public:
+  NextBatchAwaiter(LoadCellReactor &reactor, LoadCell485 &loadcell,
+                   LoadCellStatus *out_status, std::size_t capacity,
+                   std::size_t &out_count, std::chrono::microseconds timeout,
+                   CancelToken *token) noexcept;
+  ~NextBatchAwaiter() override;
+
+    bool await_ready() noexcept;
+    bool await_suspend(std::coroutine_handle<> handle) noexcept;
+    AwaitResult await_resume() const noexcept { return result_; }
+
+    bool OnReadable(bool hang_up) noexcept override;
+    void Complete(AwaitResult result) noexcept override { result_ = result; }
+
+private:
+    bool TryReceive_() noexcept;
+
+    LoadCell485 &loadcell_;
+    LoadCellStatus *out_status_;
+    std::size_t capacity_;
+    std::size_t &out_count_;
+    std::chrono::microseconds timeout_;
+    AwaitResult result_ = AwaitResult::kTimeout;
+};
+
+inline NextFrameAwaiter NextFrame(LoadCellReactor &reactor, LoadCell485 &loadcell,
+                                  LoadCellStatus &out_status,
+                                  std::chrono::microseconds timeout,
+                                  CancelToken *token = nullptr) noexcept {
+  return NextFrameAwaiter(reactor, loadcell, out_status, timeout, token);
+}
+
+inline NextBatchAwaiter NextBatch(LoadCellReactor &reactor, LoadCell485 &loadcell,
+                                  LoadCellStatus *out_status, std::size_t capacity,
+                                  std::size_t &out_count,
+                                  std::chrono::microseconds timeout,
+                                  CancelToken *token = nullptr) noexcept {
+  return NextBatchAwaiter(reactor, loadcell, out_status, capacity, out_count, timeout,
+                          token);
+}
+} // namespace loadcell_comm
+
+#endif // LOADCELL_CORO_H_
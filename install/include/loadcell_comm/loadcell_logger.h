@@ -0,0 +1,154 @@
+#ifndef LOADCELL_LOGGER_H_
+#define LOADCELL_LOGGER_H_
+
+#include "loadcell_status.h"
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+template <typename T> class SpscQueue;
+
+namespace loadcell_comm {
+// 로그 레코드 (64 bytes 고정, host byte order)
+struct LoadCellLogRecord {
+  uint64_t sequence;      // Append 순번 (큐 포화로 버려진 레코드는 번호가 비어 있음)
+  int64_t monotonic_ns;
+  int64_t realtime_ns;
+  double gross_weight;
+  double right_weight;
+  double left_weight;
+
+  uint8_t right_battery_percent;
+  uint8_t right_charge_status;
+  uint8_t right_online_status;
+  uint8_t left_battery_percent;
+  uint8_t left_charge_status;
+  uint8_t left_online_status;
+  uint8_t gross_net_mark;
+  uint8_t overload_mark;
+  uint8_t out_of_tolerance_mark;
+  uint8_t reserved[7];
+};
+static_assert(sizeof(LoadCellLogRecord) == 64, "LoadCellLogRecord layout");
+
+// 세그먼트 파일 헤더 (64 bytes), 뒤에 capacity_records 개의 레코드 영역이 미리 할당됨
+struct LoadCellLogSegmentHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  uint64_t capacity_records;
+  uint64_t segment_index;
+  uint64_t committed_records; // 기록 완료된 레코드 수 (writer가 release store)
+  uint8_t reserved[24];
+};
+static_assert(sizeof(LoadCellLogSegmentHeader) == 64, "LoadCellLogSegmentHeader layout");
+
+struct LoadCellLoggerConfig {
+  std::string directory = ".";
+  std::string prefix = "loadcell";          // <directory>/<prefix>_000000.lclog
+  std::size_t records_per_segment = 65536;  // 세그먼트당 레코드 수 (4 MiB)
+  std::size_t max_segments = 0;             // 0: 무제한, 그 외: 초과 시 가장 오래된 세그먼트 삭제
+  std::size_t queue_records = 8192;         // 수신 경로 ↔ 기록 스레드 간 큐 크기
+  std::chrono::milliseconds flush_interval{1000}; // msync 주기
+  std::chrono::microseconds idle_sleep{1000};     // 큐가 비었을 때 기록 스레드 대기
+};
+
+LoadCellLogRecord ToLogRecord(const LoadCellStatus &status, uint64_t sequence) noexcept;
+LoadCellStatus ToStatus(const LoadCellLogRecord &record) noexcept;
+
+// 비동기 mmap 바이너리 로거
+// - Append(): 수신 스레드 1개 전용, 레코드 1개 memcpy 후 lock-free 큐에 넣고 즉시 반환
+// - 기록 스레드: 큐 → 미리 할당된 mmap 세그먼트로 복사, 주기적 msync, 가득 차면 다음 세그먼트
+class LoadCellLogger {
+public:
+  LoadCellLogger();
+  ~LoadCellLogger();
+
+    LoadCellLogger(const LoadCellLogger &) = delete;
+    LoadCellLogger &operator=(const LoadCellLogger &) = delete;
+
+    bool Start(const LoadCellLoggerConfig &cfg);
+    // 큐에 남은 레코드를 모두 기록하고 세그먼트를 닫음
+    void Stop() noexcept;
+    bool IsRunning() const noexcept;
+
+    // 큐가 가득 차면 false (레코드는 버려지고 DroppedRecords 증가)
+    bool Append(const LoadCellStatus &status) noexcept;
+
+    uint64_t DroppedRecords() const noexcept;
+    uint64_t WrittenRecords() const noexcept;
+
+    // 기록 스레드가 멈춘 뒤에만 유효
+    const std::string &GetLastError() const noexcept;
+
+private:
+    void RunLoop_() noexcept;
+    bool OpenSegment_() noexcept;
+    void CloseSegment_() noexcept;
+    void WriteRecords_(const LoadCellLogRecord *records, std::size_t count) noexcept;
+
+private:
+    LoadCellLoggerConfig config_;
+    std::unique_ptr<SpscQueue<LoadCellLogRecord>> queue_;
+
+    std::thread worker_;
+    std::atomic<bool> stop_requested_{false};
+    std::atomic<bool> running_{false};
+    std::atomic<uint64_t> dropped_records_{0};
+    std::atomic<uint64_t> written_records_{0};
+    uint64_t next_sequence_ = 0;
+
+    // 기록 스레드 전용
+    uint8_t *segment_ = nullptr;
+    std::size_t segment_bytes_ = 0;
+    uint64_t segment_index_ = 0;
+    uint64_t segment_records_ = 0;
+    std::vector<std::string> segment_paths_;
+
+    std::string last_error_;
+};
+
+// 세그먼트 파일 reader (mmap, 복사 없는 순차 조회)
+class LoadCellLogReader {
+public:
+  LoadCellLogReader() = default;
+  ~LoadCellLogReader();
+
+    LoadCellLogReader(const LoadCellLogReader &) = delete;
+    LoadCellLogReader &operator=(const LoadCellLogReader &) = delete;
+
+    // directory 안의 <prefix>_NNNNNN.lclog 세그먼트 경로 (index 오름차순)
+    static std::vector<std::string> ListSegments(const std::string &directory,
+                                                 const std::string &prefix);
+
+    bool Open(const std::string &segment_path);
+    void Close() noexcept;
+
+    // 기록 완료된 레코드 (Open 시점 기준)
+    const LoadCellLogRecord *begin() const noexcept { return records_; }
+    const LoadCellLogRecord *end() const noexcept { return records_ + record_count_; }
+    std::size_t RecordCount() const noexcept { return record_count_; }
+    uint64_t SegmentIndex() const noexcept { return segment_index_; }
+
+    // 순차 조회 (끝이면 false)
+    bool Next(LoadCellLogRecord &out_record) noexcept;
+
+    const std::string &GetLastError() const noexcept { return last_error_; }
+
+private:
+    uint8_t *mapped_ = nullptr;
+    std::size_t mapped_bytes_ = 0;
+    const LoadCellLogRecord *records_ = nullptr;
+    std::size_t record_count_ = 0;
+    std::size_t cursor_ = 0;
+    uint64_t segment_index_ = 0;
+    std::string last_error_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_LOGGER_H_
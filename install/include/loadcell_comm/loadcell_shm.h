@@ -0,0 +1,92 @@
+#ifndef LOADCELL_SHM_H_
+#define LOADCELL_SHM_H_
+
+#include "loadcell_logger.h"
+#include "loadcell_status.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace loadcell_comm {
+struct ShmSegment;
+
+struct ShmPublisherConfig {
+  // shm_open 이름 (/dev/shm/<name>), '/'로 시작
+  std::string name = "/loadcell_comm";
+  // 최근 프레임 보관 개수 (0: 최신값만)
+  std::size_t history_frames = 0;
+  // 세그먼트 권한 (reader 프로세스가 다른 사용자면 0644 등으로 조정)
+  unsigned int mode = 0644;
+};
+
+// 디코딩된 프레임을 POSIX 공유 메모리에 게시 (단일 writer)
+// - 프레임은 64 bytes LoadCellLogRecord (sequence, 수신 시각 포함)로 seqlock 슬롯에 기록
+// - Publish(): memcpy + atomic store만 수행 (시스템 콜/할당/lock 없음)
+// - 같은 이름의 기존 세그먼트는 unlink 후 새로 생성, Close() 시 unlink
+class LoadCellShmPublisher {
+public:
+  LoadCellShmPublisher() = default;
+  ~LoadCellShmPublisher();
+
+    LoadCellShmPublisher(const LoadCellShmPublisher &) = delete;
+    LoadCellShmPublisher &operator=(const LoadCellShmPublisher &) = delete;
+
+    bool Open(const ShmPublisherConfig &cfg);
+    // 세그먼트를 closed로 표시 후 unmap/unlink (이미 연결된 reader는 IsClosed()로 감지)
+    void Close() noexcept;
+    bool IsOpen() const noexcept { return segment_ != nullptr; }
+
+    // 수신 스레드 1개 전용
+    void Publish(const LoadCellStatus &status) noexcept;
+    // 지금까지 게시한 프레임 수 (마지막 프레임의 sequence)
+    uint64_t Sequence() const noexcept { return sequence_; }
+
+    const std::string &GetLastError() const noexcept { return last_error_; }
+
+private:
+    ShmSegment *segment_ = nullptr;
+    std::size_t mapped_bytes_ = 0;
+    std::string name_;
+    uint64_t sequence_ = 0;
+    std::string last_error_;
+};
+
+// 다른 프로세스에서 게시된 프레임을 읽는 read-only client
+// - Latest()/ReadSince()는 공유 메모리 읽기만 수행 (시스템 콜/할당/lock 없음)
+// - 여러 스레드에서 동시에 호출 가능
+class LoadCellShmReader {
+public:
+  LoadCellShmReader() = default;
+  ~LoadCellShmReader();
+
+    LoadCellShmReader(const LoadCellShmReader &) = delete;
+    LoadCellShmReader &operator=(const LoadCellShmReader &) = delete;
+
+    // publisher가 아직 세그먼트를 만들지 않았거나 형식이 다르면 false
+    bool Open(const std::string &name = "/loadcell_comm");
+    void Close() noexcept;
+    bool IsOpen() const noexcept { return segment_ != nullptr; }
+
+    // 최신 프레임, 아직 게시된 프레임이 없으면 false
+    bool Latest(LoadCellLogRecord &out_record) const noexcept;
+    // sequence > after_sequence 인 프레임을 오래된 순으로 최대 capacity개 (최근 것 우선 보존)
+    // history에서 이미 덮어쓴 프레임은 빠짐 → 호출자는 sequence 간격으로 유실 감지
+    // history_frames == 0 이면 Latest만 반환
+    std::size_t ReadSince(uint64_t after_sequence, LoadCellLogRecord *out_records,
+                          std::size_t capacity) const noexcept;
+    // 마지막으로 게시된 sequence (게시 전 0)
+    uint64_t Sequence() const noexcept;
+    std::size_t HistoryFrames() const noexcept;
+    // publisher가 Close() 함 → Close() 후 재Open 필요
+    bool IsClosed() const noexcept;
+
+    const std::string &GetLastError() const noexcept { return last_error_; }
+
+private:
+    const ShmSegment *segment_ = nullptr;
+    std::size_t mapped_bytes_ = 0;
+    std::string last_error_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_SHM_H_
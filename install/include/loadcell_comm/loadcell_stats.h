@@ -0,0 +1,101 @@
+#ifndef LOADCELL_STATS_H_
+#define LOADCELL_STATS_H_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace loadcell_comm {
+// 수신 파이프라인 누적 통계 스냅샷 (모든 값은 Open 이후가 아닌 객체 생성 이후 누적)
+struct LoadCellStats {
+  uint64_t read_calls = 0;      // SerialPort read 호출 수
+  uint64_t read_errors = 0;     // read 실패 수 (kIoReadFail)
+  uint64_t bytes_read = 0;      // 수신 바이트 수
+  uint64_t frames_decoded = 0;  // 디코딩된 프레임 수
+  uint64_t resync_events = 0;   // 동기 이탈 후 헤더 재탐색 횟수 (연속 폐기 구간 1회 = 1)
+  uint64_t bytes_discarded = 0; // 헤더가 아니어서 폐기된 바이트 수
+  uint64_t overflow_events = 0; // 링버퍼 용량 초과 발생 횟수
+  uint64_t overflow_bytes = 0;  // 용량 초과로 버려진 oldest 바이트 수
+};
+
+// 단일 writer 누적 카운터
+// - writer는 lock 접두 RMW 없이 relaxed load/store로 증가 (hot path 비용 최소화)
+// - 임의 스레드에서 Load() 가능 (tearing 없음)
+class StatCounter {
+public:
+  void Add(uint64_t delta) noexcept {
+    value_.store(value_.load(std::memory_order_relaxed) + delta,
+                 std::memory_order_relaxed);
+  }
+
+  // 현재 값보다 클 때만 갱신 (최댓값 추적)
+  void StoreMax(uint64_t value) noexcept {
+    if (value > value_.load(std::memory_order_relaxed))
+      value_.store(value, std::memory_order_relaxed);
+  }
+
+  uint64_t Load() const noexcept { return value_.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint64_t> value_{0};
+};
+// 지연 시간 히스토그램 스냅샷
+// bucket i: [2^i, 2^(i+1)) ns 구간 (bucket 0은 0~1ns 포함, 마지막 bucket은 상한 없음)
+struct LatencyHistogramSnapshot {
+  static constexpr std::size_t kBuckets = 40;
+
+  std::array<uint64_t, kBuckets> counts{};
+  uint64_t count = 0;
+  uint64_t sum_ns = 0;
+  uint64_t max_ns = 0;
+
+  // 백분위(0.0~1.0) 상한 추정치 (bucket 상한값, ns)
+  uint64_t PercentileUpperNs(double quantile) const noexcept {
+    if (count == 0)
+      return 0;
+    const double target = quantile * static_cast<double>(count);
+    uint64_t seen = 0;
+    for (std::size_t i = 0; i < kBuckets; ++i) {
+      seen += counts[i];
+      if (static_cast<double>(seen) >= target)
+        return (i + 1 < 64) ? (uint64_t{1} << (i + 1)) : max_ns;
+    }
+    return max_ns;
+  }
+};
+
+// 단일 writer log2 지연 히스토그램 (임의 스레드에서 Snapshot 가능)
+class LatencyHistogram {
+public:
+  void Record(int64_t latency_ns) noexcept {
+    const uint64_t value = latency_ns > 0 ? static_cast<uint64_t>(latency_ns) : 0;
+    std::size_t bucket = value > 1 ? static_cast<std::size_t>(63 - __builtin_clzll(value)) : 0;
+    if (bucket >= LatencyHistogramSnapshot::kBuckets)
+      bucket = LatencyHistogramSnapshot::kBuckets - 1;
+
+    counts_[bucket].Add(1);
+    count_.Add(1);
+    sum_ns_.Add(value);
+    max_ns_.StoreMax(value);
+  }
+
+  LatencyHistogramSnapshot Snapshot() const noexcept {
+    LatencyHistogramSnapshot snapshot;
+    for (std::size_t i = 0; i < LatencyHistogramSnapshot::kBuckets; ++i)
+      snapshot.counts[i] = counts_[i].Load();
+    snapshot.count = count_.Load();
+    snapshot.sum_ns = sum_ns_.Load();
+    snapshot.max_ns = max_ns_.Load();
+    return snapshot;
+  }
+
+private:
+  std::array<StatCounter, LatencyHistogramSnapshot::kBuckets> counts_;
+  StatCounter count_;
+  StatCounter sum_ns_;
+  StatCounter max_ns_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_STATS_H_
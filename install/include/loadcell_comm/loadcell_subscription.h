@@ -0,0 +1,87 @@
+#ifndef LOADCELL_SUBSCRIPTION_H_
+#define LOADCELL_SUBSCRIPTION_H_
+
+#include "loadcell_record.h"
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace loadcell_comm {
+// 변경 통지 사유 (비트 OR)
+enum ChangeMask : uint8_t {
+  kChangeFirst = 0x01,     // 구독 후 첫 프레임
+  kChangeWeight = 0x02,    // 무게 채널 중 하나 이상이 deadband 초과
+  kChangeStatus = 0x04,    // 배터리/충전/온라인/마크 바이트 변경
+  kChangeHeartbeat = 0x08, // 변화 없이 heartbeat 간격 경과
+};
+
+struct SubscriptionConfig {
+  // 마지막 통지 값 대비 |Δraw| > deadband_counts 이면 통지 (보정 전 count 단위)
+  // 보정 후 단위 deadband = deadband_counts * gain
+  int32_t deadband_counts = 0;
+  // 마지막 통지 후 이 시간이 지나면 변화가 없어도 통지 (0: 비활성)
+  // 프레임 수신 시에만 판단하므로 통지가 끊기면 장치/회선 정지로 판단 가능
+  std::chrono::milliseconds heartbeat{1000};
+};
+
+// 연속 프레임 중 통지할 프레임을 고르는 판정기 (할당/예외 없음)
+// - double 대신 24 bytes raw 레코드 비교: 정수 차 3회 + 상태 9 bytes 비교
+// - 기준값은 마지막으로 통지한 프레임 → 느린 drift도 누적되면 통지됨
+class ChangeDetector {
+public:
+  ChangeDetector() noexcept : ChangeDetector(SubscriptionConfig{}) {}
+  explicit ChangeDetector(const SubscriptionConfig &cfg) noexcept
+      : deadband_(cfg.deadband_counts < 0 ? 0 : cfg.deadband_counts),
+        heartbeat_ns_(std::chrono::duration_cast<std::chrono::nanoseconds>(cfg.heartbeat).count()) {}
+
+    // 통지 대상이면 ChangeMask 비트 반환 및 기준값 갱신, 아니면 0
+    // now_ns: 프레임 수신 시각 (CLOCK_MONOTONIC)
+    uint8_t Check(const LoadCellRecord &record, int64_t now_ns) noexcept {
+      uint8_t changes = 0;
+      if (!has_last_) {
+        changes = kChangeFirst;
+      } else {
+        if (Exceeds_(record.gross_raw, last_.gross_raw) ||
+            Exceeds_(record.right_raw, last_.right_raw) ||
+            Exceeds_(record.left_raw, last_.left_raw))
+          changes |= kChangeWeight;
+        if (std::memcmp(&record.right_battery_percent, &last_.right_battery_percent,
+                        kStatusBytes) != 0)
+          changes |= kChangeStatus;
+        if (changes == 0 && heartbeat_ns_ > 0 && now_ns - last_notify_ns_ >= heartbeat_ns_)
+          changes = kChangeHeartbeat;
+      }
+
+      if (changes != 0) {
+        last_ = record;
+        last_notify_ns_ = now_ns;
+        has_last_ = true;
+      }
+      return changes;
+    }
+
+    // 다음 프레임을 첫 프레임으로 취급 (재연결 등)
+    void Reset() noexcept { has_last_ = false; }
+
+private:
+    // right_battery_percent ~ out_of_tolerance_mark
+    static constexpr std::size_t kStatusBytes = 9;
+    static_assert(offsetof(LoadCellRecord, out_of_tolerance_mark) -
+                          offsetof(LoadCellRecord, right_battery_percent) + 1 == kStatusBytes,
+                  "LoadCellRecord status bytes must be contiguous");
+
+    bool Exceeds_(int32_t value, int32_t reference) const noexcept {
+      const int64_t diff = static_cast<int64_t>(value) - reference;
+      return diff > deadband_ || diff < -static_cast<int64_t>(deadband_);
+    }
+
+    LoadCellRecord last_;
+    int64_t last_notify_ns_ = 0;
+    int32_t deadband_ = 0;
+    int64_t heartbeat_ns_ = 0;
+    bool has_last_ = false;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_SUBSCRIPTION_H_
@@ -0,0 +1,108 @@
+#ifndef LOADCELL_SUPERVISOR_H_
+#define LOADCELL_SUPERVISOR_H_
+
+#include "SerialConfig.h"
+#include "loadcell_status.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace loadcell_comm {
+class LoadCell485;
+
+enum class ConnectionState {
+  kDisconnected = 0,
+  kConnected = 1,
+};
+
+struct ConnectionEvent {
+  ConnectionState state = ConnectionState::kDisconnected;
+  int64_t monotonic_ns = 0; // 상태 전환 시각 (CLOCK_MONOTONIC)
+  int64_t outage_ns = 0;    // kConnected: 직전 연결 해제 ~ 재연결 소요 시간 (최초 연결은 0)
+  std::string detail;       // 해제 원인 (read 오류, 장치 노드 삭제 등) 또는 연결된 장치 경로
+};
+
+// 장치 분리/재연결 감시 (hot-plug)
+// - 장치 경로의 디렉터리(/dev, /dev/serial/by-id 등)를 inotify로 감시
+//   디렉터리가 아직 없으면 가장 가까운 상위 디렉터리를 감시하다 생성되면 내려감
+// - read 오류/hang-up/노드 삭제 → 포트 닫고 kDisconnected 통지
+// - 노드 생성/권한 변경(udev) 이벤트 즉시 재Open + termios 재설정,
+//   커널 입력 버퍼와 LoadCell485 링버퍼의 이전 바이트는 버림
+// - inotify 이벤트를 놓친 경우를 위해 retry_interval마다 재시도 (0: inotify만 사용)
+// - 노드가 남아 있는 채 분리(일시적 read 오류/EIO 등)되면 inotify 이벤트가 없으므로
+//   retry_interval과 무관하게 즉시 1회, 이후 최소 kMinRetryInterval 간격으로 재시도
+// 모든 동작은 RecvUntil/RecvFor를 호출한 스레드에서 수행 (별도 스레드 없음)
+class LoadCellSupervisor {
+public:
+  using StateCallback = std::function<void(const ConnectionEvent &event)>;
+
+  // retry_interval이 0일 때 노드가 남아 있는 분리의 재시도 간격
+  // (직전 연결이 이보다 짧았으면 즉시 재시도하지 않음 → 오류 반복 시 busy loop 방지)
+  static constexpr std::chrono::milliseconds kMinRetryInterval{100};
+
+  // loadcell은 SerialPort transport여야 하며 Supervisor보다 오래 살아 있어야 함
+  explicit LoadCellSupervisor(LoadCell485 &loadcell);
+  ~LoadCellSupervisor();
+
+    LoadCellSupervisor(const LoadCellSupervisor &) = delete;
+    LoadCellSupervisor &operator=(const LoadCellSupervisor &) = delete;
+
+    // 상태 전환 통지 (Start 전에 설정)
+    void SetStateCallback(StateCallback callback);
+
+    // 감시 시작 및 첫 연결 시도, 장치가 없어도 감시는 시작됨 (inotify 생성 실패 시에만 false)
+    // cfg.non_blocking은 true로 보정됨
+    bool Start(const SerialConfig &cfg,
+               std::chrono::milliseconds retry_interval = std::chrono::milliseconds(1000));
+    // 감시 종료 및 포트 닫기
+    void Stop() noexcept;
+
+    // 연결 상태와 무관하게 deadline까지 프레임 1개 수신 대기
+    // 분리 중에는 재연결을 처리하며 대기, 기한 내 프레임이 없으면 kTimeout
+    ResultCode RecvUntil(std::chrono::steady_clock::time_point deadline,
+                         LoadCellStatus &out_status);
+    ResultCode RecvFor(std::chrono::microseconds timeout, LoadCellStatus &out_status);
+
+    ConnectionState State() const noexcept { return state_; }
+    // 재연결 성공 횟수 (최초 연결 제외)
+    uint64_t Reconnects() const noexcept { return reconnects_; }
+
+    const std::string &GetLastError() const noexcept { return last_error_; }
+
+private:
+    bool TryConnect_();
+    bool RetryArmed_() const noexcept;
+    std::chrono::milliseconds RetryInterval_() const noexcept;
+    void Disconnect_(std::string detail);
+    void HandleWatchEvents_();
+    void RefreshWatch_();
+    void Notify_(ConnectionEvent event);
+
+private:
+    LoadCell485 &loadcell_;
+    SerialConfig config_;
+    StateCallback callback_;
+    std::chrono::milliseconds retry_interval_{1000};
+
+    ConnectionState state_ = ConnectionState::kDisconnected;
+    bool started_ = false;
+    bool ever_connected_ = false;
+    int64_t disconnected_ns_ = 0;
+    std::chrono::steady_clock::time_point connected_since_;
+    std::chrono::steady_clock::time_point next_retry_;
+    // 노드가 남아 있는 채 분리됨 → retry_interval == 0이어도 타이머 재시도
+    bool node_present_retry_ = false;
+    uint64_t reconnects_ = 0;
+
+    int inotify_fd_ = -1;
+    int watch_fd_ = -1;
+    std::string watched_dir_;
+    std::string device_dir_;
+    std::string device_name_;
+
+    std::string last_error_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_SUPERVISOR_H_
@@ -0,0 +1,78 @@
+#ifndef LOADCELL_TRACE_H_
+#define LOADCELL_TRACE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <time.h>
+
+// 수신 경로 trace point (컴파일 시 선택)
+// -DLOADCELL_COMM_TRACE=ON (CMake) → LOADCELL_COMM_TRACE=1 정의, 아니면 매크로는 빈 문장 (비용 0)
+#ifndef LOADCELL_COMM_TRACE
+#define LOADCELL_COMM_TRACE 0
+#endif
+
+namespace loadcell_comm {
+constexpr bool kTraceCompiled = LOADCELL_COMM_TRACE != 0;
+// 스레드당 보관 이벤트 수 (가득 차면 오래된 것부터 덮어씀)
+constexpr std::size_t kTraceEventsPerThread = 8192;
+
+// 지금까지 기록된 이벤트 (스레드별 최근 kTraceEventsPerThread - 1개, 기록 중인 슬롯 제외)를
+// Chrome/Perfetto trace-event JSON으로 반환 (chrome://tracing, ui.perfetto.dev에서 열기)
+// 기록 중인 스레드가 있어도 호출 가능, 복사 도중 덮어쓴 이벤트는 제외
+std::string ChromeTraceJson();
+// ChromeTraceJson()을 파일로 저장 (실패 시 false)
+bool WriteChromeTrace(const std::string &path);
+// 이후 덤프에서 지금까지의 이벤트 제외
+void ClearTrace();
+// 호출 스레드의 링을 미리 할당 (수신 경로의 첫 trace point가 첫 할당이 되지 않도록)
+// LoadCell485::Open()과 LoadCellAcquisition 수신 스레드는 자동 호출,
+// 다른 스레드에서 RecvOnce 등을 부르면 수신 전에 LOADCELL_TRACE_PREPARE_THREAD()
+void PrepareTraceThread() noexcept;
+// 호출 스레드 이름 (trace 뷰어의 스레드 이름, 링도 할당)
+void SetTraceThreadName(const char *name);
+
+namespace trace_detail {
+inline int64_t NowNs() noexcept {
+  timespec ts{};
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+// 호출 스레드의 링에 완료 이벤트 1개 기록 (링이 없으면 할당, PrepareTraceThread() 참고)
+// name은 문자열 리터럴 등 프로세스 종료까지 유효해야 함
+void Record(const char *name, int64_t begin_ns, int64_t end_ns, uint64_t arg) noexcept;
+
+class Scope {
+public:
+  explicit Scope(const char *name) noexcept : name_(name), begin_ns_(NowNs()) {}
+  ~Scope() { Record(name_, begin_ns_, NowNs(), arg_); }
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    void SetArg(uint64_t arg) noexcept { arg_ = arg; }
+
+private:
+    const char *name_;
+    int64_t begin_ns_;
+    uint64_t arg_ = 0;
+};
+} // namespace trace_detail
+} // namespace loadcell_comm
+
+#if LOADCELL_COMM_TRACE
+// 블록 끝까지의 구간 기록 (블록당 1개)
+#define LOADCELL_TRACE_SCOPE(name) ::loadcell_comm::trace_detail::Scope lc_trace_scope_(name)
+// 같은 블록의 LOADCELL_TRACE_SCOPE에 숫자 인자 첨부 (바이트 수, 결과 코드 등)
+#define LOADCELL_TRACE_ARG(value) lc_trace_scope_.SetArg(static_cast<uint64_t>(value))
+#define LOADCELL_TRACE_THREAD_NAME(name) ::loadcell_comm::SetTraceThreadName(name)
+#define LOADCELL_TRACE_PREPARE_THREAD() ::loadcell_comm::PrepareTraceThread()
+#else
+#define LOADCELL_TRACE_SCOPE(name) ((void)0)
+#define LOADCELL_TRACE_ARG(value) ((void)0)
+#define LOADCELL_TRACE_THREAD_NAME(name) ((void)0)
+#define LOADCELL_TRACE_PREPARE_THREAD() ((void)0)
+#endif
+
+#endif // LOADCELL_TRACE_H_
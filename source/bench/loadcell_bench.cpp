@@ -0,0 +1,909 @@
+// loadcell_comm 파서/링버퍼 마이크로벤치마크
+//
+// 사용법: loadcell_bench [--filter SUBSTR] [--rounds N]
+//         loadcell_bench --check-alloc [--frames N]
+//         loadcell_bench [--filter SUBSTR] --trace FILE
+//         loadcell_bench --check-serial
+// 결과는 한 줄에 하나씩 JSON 객체로 stdout에 출력 (JSON Lines)
+// --check-alloc: LoadCell485 정상 수신 경로에서 operator new 호출이 1회라도 있으면 exit 1
+// --check-serial: pty를 SerialConfig 조합별로 열고 termios/termios2 설정값을 다시 읽어 대조 (불일치 시 exit 1)
+// --trace: 벤치 종료 후 수신 경로 trace를 Chrome trace JSON으로 저장 (-DLOADCELL_COMM_TRACE=ON 빌드 전용)
+#include "ByteRingBuffer.h"
+#include "ByteTransport.h"
+#include "CaptureFormat.h"
+#include "ReplayTransport.h"
+#include "SerialConfig.h"
+#include "SerialIoctl.h"
+#include "SerialPort.h"
+#include "loadcell_485.h"
+#include "loadcell_batch_decoder.h"
+#include "loadcell_frame_parser.h"
+#include "loadcell_subscription.h"
+#include "loadcell_trace.h"
+#include "sync_scanner.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <new>
+#include <random>
+#include <string>
+#include <termios.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace loadcell_comm;
+
+// --check-alloc: 전역 operator new 호출 횟수 (공유 라이브러리 내부 할당 포함)
+static std::atomic<uint64_t> g_new_calls{0};
+
+void *operator new(std::size_t size) {
+  g_new_calls.fetch_add(1, std::memory_order_relaxed);
+  if (void *p = std::malloc(size ? size : 1))
+    return p;
+  throw std::bad_alloc();
+}
+
+void *operator new[](std::size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete[](void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+constexpr std::size_t kFrameBytes = FrameParser::kFrameBytes;
+constexpr std::size_t kParserBufferBytes = 4096;
+constexpr std::size_t kReadChunkBytes = 256;
+constexpr std::size_t kStreamFrames = 20000;
+
+struct Options {
+  std::string filter;
+  int rounds = 5;
+  bool check_alloc = false;
+  bool check_serial = false;
+  uint64_t alloc_frames = 1000000;
+  std::string trace_path;
+};
+
+struct Result {
+  std::string name;
+  uint64_t items = 0;   // 처리 단위 수 (프레임 또는 바이트)
+  uint64_t bytes = 0;
+  double best_ns = 0.0; // rounds 중 최소 소요 시간
+};
+
+// 최적화로 결과가 제거되지 않도록 누적
+volatile uint64_t g_sink = 0;
+
+std::vector<uint8_t> MakeFrame(int32_t weight) {
+  std::vector<uint8_t> frame(kFrameBytes, 0);
+  frame[0] = 0x55;
+  frame[1] = 0xAB;
+  frame[2] = 0x01;
+  const uint32_t u = static_cast<uint32_t>(weight);
+  for (int i = 0; i < 3; ++i) {
+    const std::size_t offset = 4 + static_cast<std::size_t>(i) * 4;
+    frame[offset + 0] = static_cast<uint8_t>(u >> 24);
+    frame[offset + 1] = static_cast<uint8_t>(u >> 16);
+    frame[offset + 2] = static_cast<uint8_t>(u >> 8);
+    frame[offset + 3] = static_cast<uint8_t>(u);
+  }
+  frame[16] = 80;
+  frame[19] = 75;
+  return frame;
+}
+
+// noise_ratio: 전체 바이트 중 프레임 사이 잡음 바이트 비율 (0.0 ~ 0.9)
+std::vector<uint8_t> MakeStream(std::size_t frames, double noise_ratio, uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  const double noise_per_frame = noise_ratio / (1.0 - noise_ratio) * kFrameBytes;
+  std::poisson_distribution<int> noise_dist(noise_per_frame > 0.0 ? noise_per_frame : 1.0);
+
+  std::vector<uint8_t> stream;
+  stream.reserve(static_cast<std::size_t>(frames * (kFrameBytes + noise_per_frame * 1.5)));
+  for (std::size_t i = 0; i < frames; ++i) {
+    if (noise_ratio > 0.0) {
+      const int noise = noise_dist(rng);
+      for (int k = 0; k < noise; ++k) {
+        // 헤더 첫 바이트는 섞되 완전한 헤더는 만들지 않음
+        uint8_t b = static_cast<uint8_t>(byte_dist(rng));
+        if (b == 0xAB)
+          b = 0xAC;
+        stream.push_back(b);
+      }
+    }
+    const std::vector<uint8_t> frame = MakeFrame(static_cast<int32_t>(i));
+    stream.insert(stream.end(), frame.begin(), frame.end());
+  }
+  return stream;
+}
+
+double TimeNs(const std::function<void()> &body) {
+  const auto begin = std::chrono::steady_clock::now();
+  body();
+  const auto end = std::chrono::steady_clock::now();
+  return static_cast<double>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+}
+
+Result Measure(const Options &options, std::string name, uint64_t items,
+               uint64_t bytes, const std::function<void()> &body) {
+  Result result{std::move(name), items, bytes, 0.0};
+  body(); // warm-up
+  for (int round = 0; round < options.rounds; ++round) {
+    const double ns = TimeNs(body);
+    if (round == 0 || ns < result.best_ns)
+      result.best_ns = ns;
+  }
+  return result;
+}
+
+void Print(const Result &result, const char *unit) {
+  const double per_item_ns = result.items ? result.best_ns / static_cast<double>(result.items) : 0.0;
+  const double items_per_sec = result.best_ns > 0.0 ? static_cast<double>(result.items) * 1e9 / result.best_ns : 0.0;
+  const double mb_per_sec = result.best_ns > 0.0 ? static_cast<double>(result.bytes) * 1e3 / result.best_ns : 0.0;
+  std::printf("{\"name\":\"%s\",\"unit\":\"%s\",\"items\":%llu,\"bytes\":%llu,"
+              "\"best_ns\":%.0f,\"ns_per_item\":%.2f,\"items_per_sec\":%.0f,\"mb_per_sec\":%.1f}\n",
+              result.name.c_str(), unit,
+              static_cast<unsigned long long>(result.items),
+              static_cast<unsigned long long>(result.bytes),
+              result.best_ns, per_item_ns, items_per_sec, mb_per_sec);
+  std::fflush(stdout);
+}
+
+bool Selected(const Options &options, const std::string &name) {
+  return options.filter.empty() || name.find(options.filter) != std::string::npos;
+}
+
+// 수신 스트림을 chunk_bytes 단위로 Feed하며 매 chunk마다 가능한 모든 프레임 디코딩
+uint64_t ParseStream(FrameParser &parser, const std::vector<uint8_t> &stream,
+                     std::size_t chunk_bytes) {
+  uint64_t frames = 0;
+  uint64_t checksum = 0;
+  LoadCellStatus status;
+  for (std::size_t offset = 0; offset < stream.size(); offset += chunk_bytes) {
+    const std::size_t size = std::min(chunk_bytes, stream.size() - offset);
+    parser.Feed(stream.data() + offset, size);
+    while (parser.Next(status) == ResultCode::kOk) {
+      ++frames;
+      checksum += static_cast<uint64_t>(status.gross_weight);
+    }
+  }
+  g_sink = g_sink + checksum;
+  return frames;
+}
+
+void BenchParser(const Options &options, const char *name, double noise_ratio,
+                 std::size_t chunk_bytes) {
+  if (!Selected(options, name))
+    return;
+
+  const std::vector<uint8_t> stream = MakeStream(kStreamFrames, noise_ratio, 42);
+  FrameParser parser(kParserBufferBytes);
+  uint64_t frames = 0;
+  const Result result = Measure(options, name, kStreamFrames, stream.size(), [&] {
+    parser.Reset();
+    frames = ParseStream(parser, stream, chunk_bytes);
+  });
+
+  if (frames != kStreamFrames) {
+    std::fprintf(stderr, "%s: decoded %llu of %zu frames\n", name,
+                 static_cast<unsigned long long>(frames), kStreamFrames);
+    std::exit(1);
+  }
+  Print(result, "frame");
+}
+
+void BenchRingPushDrop(const Options &options) {
+  const char *name = "ring_push_drop_256";
+  if (!Selected(options, name))
+    return;
+
+  constexpr std::size_t kOps = 200000;
+  std::vector<uint8_t> chunk(kReadChunkBytes, 0x5A);
+  ByteRingBuffer ring(kParserBufferBytes);
+  const Result result = Measure(options, name, kOps, kOps * chunk.size(), [&] {
+    for (std::size_t i = 0; i < kOps; ++i) {
+      ring.Push(chunk.data(), chunk.size());
+      ring.DropFront(chunk.size());
+    }
+    g_sink = g_sink + ring.Size();
+  });
+  Print(result, "op");
+}
+
+void BenchRingOverflow(const Options &options) {
+  const char *name = "ring_push_overflow_256";
+  if (!Selected(options, name))
+    return;
+
+  constexpr std::size_t kOps = 200000;
+  std::vector<uint8_t> chunk(kReadChunkBytes, 0x5A);
+  ByteRingBuffer ring(kParserBufferBytes);
+  const Result result = Measure(options, name, kOps, kOps * chunk.size(), [&] {
+    uint64_t dropped = 0;
+    for (std::size_t i = 0; i < kOps; ++i)
+      dropped += ring.Push(chunk.data(), chunk.size());
+    g_sink = g_sink + dropped;
+  });
+  Print(result, "op");
+}
+
+void BenchRingCopyFront(const Options &options) {
+  const char *name = "ring_copy_front_full";
+  if (!Selected(options, name))
+    return;
+
+  constexpr std::size_t kOps = 100000;
+  std::vector<uint8_t> fill(kParserBufferBytes, 0x11);
+  ByteRingBuffer ring(kParserBufferBytes);
+  ring.Push(fill.data(), fill.size() / 2);
+  ring.DropFront(fill.size() / 4);
+  ring.Push(fill.data(), fill.size() / 2);
+  std::vector<uint8_t> out;
+  const Result result = Measure(options, name, kOps, kOps * ring.Size(), [&] {
+    for (std::size_t i = 0; i < kOps; ++i)
+      g_sink = g_sink + ring.CopyFront(ring.Size(), out);
+  });
+  Print(result, "op");
+}
+
+// 기준: 모든 시작 위치 3바이트 비교
+std::size_t ReferenceScan(const uint8_t *data, std::size_t size, const SyncPattern &pattern) {
+  for (std::size_t i = 0; i + 3 <= size; ++i) {
+    if (data[i] == pattern[0] && data[i + 1] == pattern[1] && data[i + 2] == pattern[2])
+      return i;
+  }
+  return size;
+}
+
+// 구현별 결과를 기준과 대조 (SIMD 블록 경계/끝부분 처리 검증)
+// - 길이 0..kMaxLength, 시작 주소 정렬 0..31
+// - 모든 위치의 헤더, 끝부분의 부분 헤더(55 / 55 AB), 가짜 접두(55 AB xx, 55 xx 01) 포함
+// 검사 구간은 할당의 끝에 두어 범위 밖 읽기가 sanitizer 빌드에서 드러나게 함
+bool CheckScanEquivalence(ScanBackend backend, const SyncPattern &pattern) {
+  constexpr std::size_t kMaxLength = 100;
+  constexpr int kRandomTrials = 64;
+  std::mt19937 rng(8);
+  // 헤더 바이트 비중을 높여 부분 일치가 자주 생기도록 함
+  const uint8_t alphabet[] = {pattern[0], pattern[1], pattern[2], 0x00, 0xFF, 0x54, 0xAA};
+  std::uniform_int_distribution<int> symbol_dist(0, sizeof(alphabet) - 1);
+  std::uniform_int_distribution<int> align_dist(0, 31);
+
+  std::vector<uint8_t> payload;
+  auto check = [&](const char *what) {
+    const std::size_t align = static_cast<std::size_t>(align_dist(rng));
+    std::vector<uint8_t> storage(align + payload.size());
+    std::copy(payload.begin(), payload.end(), storage.begin() + align);
+    const uint8_t *data = storage.data() + align;
+
+    const std::size_t expected = ReferenceScan(data, payload.size(), pattern);
+    const std::size_t actual = FindSyncPatternWith(backend, data, payload.size(), pattern);
+    if (actual == expected)
+      return true;
+
+    std::fprintf(stderr, "scan_%s: %s, length %zu align %zu: got %zu, expected %zu\n",
+                 ScanBackendName(backend), what, payload.size(), align, actual, expected);
+    return false;
+  };
+  auto fill_without_header = [&](std::size_t length) {
+    payload.resize(length);
+    for (auto &b : payload)
+      b = alphabet[symbol_dist(rng)];
+    for (std::size_t i = 0; i + 3 <= length; ++i) {
+      if (payload[i] == pattern[0] && payload[i + 1] == pattern[1] && payload[i + 2] == pattern[2])
+        payload[i + 2] = 0x00; // 가짜 접두로 남김
+    }
+  };
+
+  for (std::size_t length = 0; length <= kMaxLength; ++length) {
+    for (int trial = 0; trial < kRandomTrials; ++trial) {
+      payload.resize(length);
+      for (auto &b : payload)
+        b = alphabet[symbol_dist(rng)];
+      if (!check("random"))
+        return false;
+    }
+
+    // 모든 위치의 헤더 (앞쪽에는 헤더 없음)
+    for (std::size_t offset = 0; offset + 3 <= length; ++offset) {
+      fill_without_header(length);
+      std::copy(pattern.begin(), pattern.end(), payload.begin() + offset);
+      for (std::size_t i = 0; i < offset && i + 3 <= length; ++i) {
+        if (payload[i] == pattern[0] && payload[i + 1] == pattern[1] && payload[i + 2] == pattern[2])
+          payload[i + 1] = 0x00;
+      }
+      if (!check("header"))
+        return false;
+    }
+
+    // 끝부분 부분 헤더 (보고하지 않아야 함)
+    for (std::size_t partial = 1; partial <= 2 && partial <= length; ++partial) {
+      fill_without_header(length);
+      std::copy(pattern.begin(), pattern.begin() + partial, payload.end() - partial);
+      if (length > partial && payload[length - partial - 1] == pattern[0] && partial == 2)
+        payload[length - partial - 1] = 0x00;
+      if (!check("partial header at tail"))
+        return false;
+    }
+  }
+  return true;
+}
+
+void BenchScanner(const Options &options) {
+  constexpr std::size_t kScanBytes = 4 * 1024 * 1024;
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  std::vector<uint8_t> noise(kScanBytes);
+  for (auto &b : noise)
+    b = static_cast<uint8_t>(byte_dist(rng));
+  // 끝에만 헤더 배치 → 전체 스캔
+  const SyncPattern pattern = {0x55, 0xAB, 0x01};
+  std::copy(pattern.begin(), pattern.end(), noise.end() - 3);
+  for (std::size_t i = 0; i + 2 < noise.size() - 3; ++i) {
+    if (noise[i] == pattern[0] && noise[i + 1] == pattern[1] && noise[i + 2] == pattern[2])
+      noise[i + 1] = 0;
+  }
+
+  const ScanBackend backends[] = {ScanBackend::kScalar, ScanBackend::kMemchr,
+                                  ScanBackend::kSse2, ScanBackend::kAvx2};
+  for (ScanBackend backend : backends) {
+    if (IsScanBackendSupported(backend) && !CheckScanEquivalence(backend, pattern))
+      std::exit(1);
+  }
+
+  for (ScanBackend backend : backends) {
+    if (!IsScanBackendSupported(backend))
+      continue;
+
+    const std::string name = std::string("scan_noise_4MiB_") + ScanBackendName(backend);
+    if (!Selected(options, name))
+      continue;
+
+    std::size_t hit = 0;
+    const Result result = Measure(options, name, kScanBytes, kScanBytes, [&] {
+      hit = FindSyncPatternWith(backend, noise.data(), noise.size(), pattern);
+    });
+    if (hit != kScanBytes - 3) {
+      std::fprintf(stderr, "%s: wrong match offset %zu\n", name.c_str(), hit);
+      std::exit(1);
+    }
+    Print(result, "byte");
+  }
+}
+
+// 유휴 저울(±2 count 잡음, 상태 고정) 스트림에서 통지 판정 비용
+// change_detect_record: ChangeDetector(24 bytes raw 레코드), change_detect_status_double: 디코딩된 필드 직접 비교
+void BenchChangeDetect(const Options &options) {
+  constexpr std::size_t kFrames = 200000;
+  constexpr int32_t kDeadband = 5;
+  std::mt19937 rng(5);
+  std::uniform_int_distribution<int32_t> noise(-2, 2);
+  std::vector<LoadCellRecord> records(kFrames);
+  std::vector<LoadCellStatus> statuses(kFrames);
+  for (std::size_t i = 0; i < kFrames; ++i) {
+    records[i].gross_raw = 12000 + noise(rng);
+    records[i].right_raw = 6000 + noise(rng);
+    records[i].left_raw = 6000 + noise(rng);
+    records[i].right_battery_percent = 80;
+    records[i].left_battery_percent = 80;
+    statuses[i] = Calibration().ToStatus(records[i]);
+  }
+
+  const char *record_name = "change_detect_record";
+  if (Selected(options, record_name)) {
+    uint64_t notified = 0;
+    const Result result = Measure(options, record_name, kFrames, kFrames * sizeof(LoadCellRecord), [&] {
+      SubscriptionConfig cfg;
+      cfg.deadband_counts = kDeadband;
+      ChangeDetector detector(cfg);
+      notified = 0;
+      for (std::size_t i = 0; i < kFrames; ++i)
+        notified += detector.Check(records[i], static_cast<int64_t>(i) * 1000000) != 0;
+    });
+    g_sink = g_sink + notified;
+    Print(result, "frame");
+  }
+
+  const char *status_name = "change_detect_status_double";
+  if (Selected(options, status_name)) {
+    const Result result = Measure(options, status_name, kFrames, kFrames * sizeof(LoadCellStatus), [&] {
+      LoadCellStatus last = statuses[0];
+      uint64_t notified = 0;
+      for (std::size_t i = 1; i < kFrames; ++i) {
+        const LoadCellStatus &s = statuses[i];
+        const bool changed =
+            std::abs(s.gross_weight - last.gross_weight) > kDeadband ||
+            std::abs(s.right_weight - last.right_weight) > kDeadband ||
+            std::abs(s.left_weight - last.left_weight) > kDeadband ||
+            s.right_battery_percent != last.right_battery_percent ||
+            s.right_charge_status != last.right_charge_status ||
+            s.right_online_status != last.right_online_status ||
+            s.left_battery_percent != last.left_battery_percent ||
+            s.left_charge_status != last.left_charge_status ||
+            s.left_online_status != last.left_online_status ||
+            s.gross_net_mark != last.gross_net_mark ||
+            s.overload_mark != last.overload_mark ||
+            s.out_of_tolerance_mark != last.out_of_tolerance_mark;
+        if (changed) {
+          last = s;
+          ++notified;
+        }
+      }
+      g_sink = g_sink + notified;
+    });
+    Print(result, "frame");
+  }
+}
+
+// 연속 25 bytes 프레임 배열 디코딩: 프레임별 ApplyScale(AoS) vs DecodeFrameBatch(SoA) 구현별
+// 측정 전 모든 구현의 결과가 ApplyScale + Calibration::Apply와 같은지 확인 (불일치 시 exit 1)
+struct DecodeColumns {
+  explicit DecodeColumns(std::size_t n)
+      : raw(3, std::vector<int32_t>(n)), weight(3, std::vector<float>(n)),
+        status(9, std::vector<uint8_t>(n)) {}
+
+  FrameColumns Columns() {
+    FrameColumns c;
+    c.gross_raw = raw[0].data();
+    c.right_raw = raw[1].data();
+    c.left_raw = raw[2].data();
+    c.gross_weight = weight[0].data();
+    c.right_weight = weight[1].data();
+    c.left_weight = weight[2].data();
+    c.right_battery_percent = status[0].data();
+    c.right_charge_status = status[1].data();
+    c.right_online_status = status[2].data();
+    c.left_battery_percent = status[3].data();
+    c.left_charge_status = status[4].data();
+    c.left_online_status = status[5].data();
+    c.gross_net_mark = status[6].data();
+    c.overload_mark = status[7].data();
+    c.out_of_tolerance_mark = status[8].data();
+    return c;
+  }
+
+  std::vector<std::vector<int32_t>> raw;
+  std::vector<std::vector<float>> weight;
+  std::vector<std::vector<uint8_t>> status;
+};
+
+bool CheckDecodeEquivalence(DecodeBackend backend, const std::vector<uint8_t> &frames,
+                            std::size_t count, const Calibration &calibration) {
+  DecodeColumns out(count);
+  DecodeFrameBatchWith(backend, frames.data(), count, out.Columns(), calibration);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    LoadCellStatus raw;
+    FrameParser::ApplyScale(frames.data() + i * kFrameBytes, raw);
+    LoadCellStatus calibrated = raw;
+    calibration.Apply(calibrated);
+
+    const double raw_weights[3] = {raw.gross_weight, raw.right_weight, raw.left_weight};
+    const double weights[3] = {calibrated.gross_weight, calibrated.right_weight, calibrated.left_weight};
+    const uint8_t status[9] = {raw.right_battery_percent, raw.right_charge_status,
+                               raw.right_online_status,   raw.left_battery_percent,
+                               raw.left_charge_status,    raw.left_online_status,
+                               raw.gross_net_mark,        raw.overload_mark,
+                               raw.out_of_tolerance_mark};
+    bool ok = true;
+    for (int c = 0; c < 3; ++c) {
+      ok = ok && out.raw[c][i] == static_cast<int32_t>(raw_weights[c]);
+      ok = ok && out.weight[c][i] == static_cast<float>(weights[c]);
+    }
+    for (int c = 0; c < 9; ++c)
+      ok = ok && out.status[c][i] == status[c];
+
+    if (!ok) {
+      std::fprintf(stderr, "decode_batch_%s: frame %zu differs from ApplyScale\n",
+                   DecodeBackendName(backend), i);
+      return false;
+    }
+  }
+  return true;
+}
+
+void BenchBatchDecode(const Options &options) {
+  constexpr std::size_t kFrames = 100000;
+  std::mt19937 rng(25);
+  std::uniform_int_distribution<int> byte_dist(0, 255);
+  std::vector<uint8_t> frames(kFrames * kFrameBytes);
+  for (std::size_t i = 0; i < kFrames; ++i) {
+    uint8_t *frame = frames.data() + i * kFrameBytes;
+    for (std::size_t b = 0; b < kFrameBytes; ++b)
+      frame[b] = static_cast<uint8_t>(byte_dist(rng));
+    frame[0] = 0x55;
+    frame[1] = 0xAB;
+    frame[2] = 0x01;
+  }
+  // 경계값: INT32_MIN / INT32_MAX / -1 / 0
+  const uint8_t edges[4][4] = {{0x80, 0, 0, 0}, {0x7F, 0xFF, 0xFF, 0xFF}, {0xFF, 0xFF, 0xFF, 0xFF}, {0, 0, 0, 0}};
+  for (std::size_t e = 0; e < 4; ++e)
+    std::memcpy(frames.data() + e * kFrameBytes + 4 + 4 * (e % 3), edges[e], 4);
+
+  CalibrationConfig cc;
+  cc.gross = ChannelCalibration{0.01, 1200.0, 3.5};
+  cc.right = ChannelCalibration{-0.02, -50.0, 0.0};
+  cc.left = ChannelCalibration{1.0 / 3.0, 7.0, 0.25};
+  const Calibration calibration(cc);
+
+  const DecodeBackend backends[] = {DecodeBackend::kScalar, DecodeBackend::kSsse3};
+  for (DecodeBackend backend : backends) {
+    if (!IsDecodeBackendSupported(backend))
+      continue;
+    // 4 프레임 단위로 나누어떨어지지 않는 길이 포함
+    if (!CheckDecodeEquivalence(backend, frames, kFrames, calibration) ||
+        !CheckDecodeEquivalence(backend, frames, 4099, calibration))
+      std::exit(1);
+  }
+
+  const char *aos_name = "decode_applyscale_aos";
+  if (Selected(options, aos_name)) {
+    std::vector<LoadCellStatus> statuses(kFrames);
+    const Result result = Measure(options, aos_name, kFrames, frames.size(), [&] {
+      for (std::size_t i = 0; i < kFrames; ++i)
+        FrameParser::ApplyScale(frames.data() + i * kFrameBytes, statuses[i]);
+      g_sink = g_sink + static_cast<uint64_t>(statuses[kFrames - 1].gross_weight);
+    });
+    Print(result, "frame");
+  }
+
+  DecodeColumns out(kFrames);
+  FrameColumns raw_columns = out.Columns();
+  raw_columns.gross_weight = raw_columns.right_weight = raw_columns.left_weight = nullptr;
+  const FrameColumns all_columns = out.Columns();
+  for (DecodeBackend backend : backends) {
+    if (!IsDecodeBackendSupported(backend))
+      continue;
+
+    const std::string raw_name = std::string("decode_batch_soa_raw_") + DecodeBackendName(backend);
+    if (Selected(options, raw_name)) {
+      const Result result = Measure(options, raw_name, kFrames, frames.size(), [&] {
+        DecodeFrameBatchWith(backend, frames.data(), kFrames, raw_columns);
+        g_sink = g_sink + static_cast<uint64_t>(out.raw[0][kFrames - 1]);
+      });
+      Print(result, "frame");
+    }
+
+    const std::string all_name = std::string("decode_batch_soa_calibrated_") + DecodeBackendName(backend);
+    if (Selected(options, all_name)) {
+      const Result result = Measure(options, all_name, kFrames, frames.size(), [&] {
+        DecodeFrameBatchWith(backend, frames.data(), kFrames, all_columns, calibration);
+        g_sink = g_sink + static_cast<uint64_t>(out.weight[0][kFrames - 1]);
+      });
+      Print(result, "frame");
+    }
+  }
+}
+
+// 256 bytes chunk 캡처 파일을 만들어 ReplayTransport(as-fast-as-possible) + LoadCell485로 재생
+void BenchReplay(const Options &options) {
+  const char *name = "replay_fast_capture_chunk256";
+  if (!Selected(options, name))
+    return;
+
+  char path[] = "/tmp/loadcell_bench_capture_XXXXXX";
+  const int fd = ::mkstemp(path);
+  if (fd < 0) {
+    std::fprintf(stderr, "%s: mkstemp failed\n", name);
+    std::exit(1);
+  }
+
+  const std::vector<uint8_t> stream = MakeStream(kStreamFrames, 0.1, 11);
+  std::FILE *file = ::fdopen(fd, "wb");
+  capture_format::CaptureFileHeader header{};
+  std::memcpy(header.magic, capture_format::kMagic, sizeof(header.magic));
+  header.version = capture_format::kVersion;
+  std::fwrite(&header, sizeof(header), 1, file);
+  for (std::size_t offset = 0; offset < stream.size(); offset += kReadChunkBytes) {
+    capture_format::CaptureChunkHeader chunk{};
+    chunk.monotonic_ns = static_cast<int64_t>(offset) * 1000;
+    chunk.size = static_cast<uint32_t>(std::min(kReadChunkBytes, stream.size() - offset));
+    std::fwrite(&chunk, sizeof(chunk), 1, file);
+    std::fwrite(stream.data() + offset, 1, chunk.size, file);
+  }
+  std::fclose(file);
+
+  uint64_t frames = 0;
+  std::vector<LoadCellStatus> batch;
+  const Result result = Measure(options, name, kStreamFrames, stream.size(), [&] {
+    LoadCell485 loadcell(std::make_unique<ReplayTransport>(path));
+    if (!loadcell.Open()) {
+      std::fprintf(stderr, "%s: %s\n", name, loadcell.GetLastError().c_str());
+      std::exit(1);
+    }
+    frames = 0;
+    while (loadcell.RecvBatch(batch) != ResultCode::kFrameTooShort || !batch.empty())
+      frames += batch.size();
+  });
+  ::unlink(path);
+
+  if (frames != kStreamFrames) {
+    std::fprintf(stderr, "%s: decoded %llu of %zu frames\n", name,
+                 static_cast<unsigned long long>(frames), kStreamFrames);
+    std::exit(1);
+  }
+  Print(result, "frame");
+}
+
+// 메모리 스트림을 불규칙한 크기로 잘라 반환하는 transport (데이터 없음 응답 포함)
+class MemoryTransport : public ByteTransport {
+public:
+  explicit MemoryTransport(std::vector<uint8_t> stream) : stream_(std::move(stream)) {}
+
+  bool Open() override { return open_ = true; }
+  void Close() noexcept override { open_ = false; }
+  bool IsOpen() const noexcept override { return open_; }
+
+  long Read(uint8_t *buf, std::size_t len) noexcept override {
+    // 0, 1, 7, 24, 25, 26, 64, 256 bytes 순환 (0은 수신 데이터 없음)
+    static constexpr std::size_t kChunks[] = {0, 1, 7, 24, 25, 26, 64, 256};
+    const std::size_t want = kChunks[calls_++ % (sizeof(kChunks) / sizeof(kChunks[0]))];
+    const std::size_t n = std::min({want, len, stream_.size() - offset_});
+    std::memcpy(buf, stream_.data() + offset_, n);
+    offset_ += n;
+    if (offset_ == stream_.size())
+      offset_ = 0;
+    if (n > 0)
+      last_read_time_.monotonic_ns = static_cast<int64_t>(calls_);
+    return static_cast<long>(n);
+  }
+  long ReadUntil(uint8_t *buf, std::size_t len,
+                 std::chrono::steady_clock::time_point) noexcept override {
+    return Read(buf, len);
+  }
+  long Write(const uint8_t *, std::size_t len) noexcept override {
+    return static_cast<long>(len);
+  }
+  const ReadTimestamp &LastReadTime() const noexcept override { return last_read_time_; }
+  const std::string &LastError() const noexcept override { return last_error_; }
+
+private:
+  std::vector<uint8_t> stream_;
+  std::size_t offset_ = 0;
+  uint64_t calls_ = 0;
+  bool open_ = false;
+  ReadTimestamp last_read_time_;
+  std::string last_error_;
+};
+
+// 정상 수신 경로(RecvOnce/RecvFor/RecvBatch)에서 할당 0회 확인
+int CheckAllocations(const Options &options) {
+  LoadCell485 loadcell(std::make_unique<MemoryTransport>(MakeStream(kStreamFrames, 0.3, 21)));
+  loadcell.Open();
+
+  std::array<LoadCellStatus, 32> batch{};
+  std::array<LoadCellRecord, 32> records{};
+  LoadCellStatus status;
+  uint64_t frames = 0;
+  uint64_t calls = 0;
+
+  // Open 직후 첫 수신도 할당 없음 (trace 링 등 지연 초기화가 수신 경로에 숨지 않도록)
+  const uint64_t first_before = g_new_calls.load(std::memory_order_relaxed);
+  while (frames == 0) {
+    if (loadcell.RecvOnce(status) == ResultCode::kOk)
+      ++frames;
+  }
+  const uint64_t first_allocations = g_new_calls.load(std::memory_order_relaxed) - first_before;
+
+  // 할당 검사 전 1바퀴 수신 (초기화 시점 할당 제외)
+  while (frames < kStreamFrames * 2) {
+    if (loadcell.RecvOnce(status) == ResultCode::kOk)
+      ++frames;
+  }
+
+  frames = 0;
+  const uint64_t before = g_new_calls.load(std::memory_order_relaxed);
+  while (frames < options.alloc_frames) {
+    std::size_t count = 0;
+    switch (calls++ % 4) {
+    case 0:
+      frames += loadcell.RecvOnce(status) == ResultCode::kOk;
+      break;
+    case 1:
+      frames += loadcell.RecvFor(std::chrono::microseconds(0), status) == ResultCode::kOk;
+      break;
+    case 2:
+      loadcell.RecvBatch(batch.data(), batch.size(), count);
+      frames += count;
+      break;
+    default:
+      loadcell.RecvBatch(records.data(), records.size(), count);
+      frames += count;
+      break;
+    }
+    g_sink = g_sink + static_cast<uint64_t>(loadcell.GetLastErrorCode());
+  }
+  const uint64_t allocations = g_new_calls.load(std::memory_order_relaxed) - before;
+
+  std::printf("{\"name\":\"alloc_check_recv\",\"frames\":%llu,\"calls\":%llu,"
+              "\"allocations\":%llu,\"first_recv_allocations\":%llu}\n",
+              static_cast<unsigned long long>(frames),
+              static_cast<unsigned long long>(calls),
+              static_cast<unsigned long long>(allocations),
+              static_cast<unsigned long long>(first_allocations));
+  return allocations == 0 && first_allocations == 0 ? 0 : 1;
+}
+
+// SerialConfig가 termios에 반영되었는지 확인 (하드웨어 없이 pty로 검증 가능한 항목)
+// stop bits, RTS/CTS, XON/XOFF, parity 검사(INPCK), VMIN/VTIME, 속도(termios2)
+bool VerifyTermios(int fd, const SerialConfig &cfg, std::string &error) {
+  termios tio{};
+  if (::tcgetattr(fd, &tio) != 0) {
+    error = "tcgetattr failed";
+    return false;
+  }
+
+  // pty 드라이버는 CSIZE/PARENB를 항상 CS8, parity 없음으로 덮어쓰므로 parity는 INPCK로만 확인
+  const bool parity = cfg.parity != 'N' && cfg.parity != 'n';
+  const struct {
+    const char *name;
+    bool actual;
+    bool expected;
+  } flags[] = {
+      {"INPCK", (tio.c_iflag & INPCK) != 0, parity},
+      {"CSTOPB", (tio.c_cflag & CSTOPB) != 0, cfg.stop_bits == 2},
+      {"CRTSCTS", (tio.c_cflag & CRTSCTS) != 0, cfg.rtscts},
+      {"IXON", (tio.c_iflag & IXON) != 0, cfg.xonxoff},
+      {"IXOFF", (tio.c_iflag & IXOFF) != 0, cfg.xonxoff},
+      {"VMIN", tio.c_cc[VMIN] == cfg.vmin, true},
+      {"VTIME", tio.c_cc[VTIME] == cfg.vtime_ds, true},
+  };
+  for (const auto &flag : flags) {
+    if (flag.actual != flag.expected) {
+      error = std::string(flag.name) + " mismatch";
+      return false;
+    }
+  }
+
+  int ispeed = 0;
+  int ospeed = 0;
+  if (!serial_ioctl::GetBaud(fd, ispeed, ospeed, error))
+    return false;
+  if (ispeed != cfg.baudrate || ospeed != cfg.baudrate) {
+    error = "baud " + std::to_string(ispeed) + "/" + std::to_string(ospeed);
+    return false;
+  }
+  return true;
+}
+
+int CheckSerialConfig() {
+  const int master = ::posix_openpt(O_RDWR | O_NOCTTY);
+  if (master < 0 || ::grantpt(master) != 0 || ::unlockpt(master) != 0) {
+    std::fprintf(stderr, "--check-serial: cannot allocate a pty\n");
+    return 1;
+  }
+
+  struct Case {
+    const char *name;
+    int baudrate;
+    uint8_t data_bits;
+    char parity;
+    uint8_t stop_bits;
+    bool rtscts;
+    bool xonxoff;
+    bool low_latency;
+    bool rs485;
+    bool expect_open;
+  };
+  // 표준 속도, BOTHER 전용 속도(250000, 31250), parity/stop bits/흐름 제어 조합
+  // pty는 ASYNC_LOW_LATENCY/TIOCSRS485를 지원하지 않으므로 Open() 실패가 정상
+  const Case cases[] = {
+      {"8n1_19200", 19200, 8, 'N', 1, false, false, false, false, true},
+      {"7e2_9600", 9600, 7, 'E', 2, false, false, false, false, true},
+      {"8o1_115200_rtscts", 115200, 8, 'O', 1, true, false, false, false, true},
+      {"7n1_921600_xonxoff", 921600, 7, 'N', 1, false, true, false, false, true},
+      {"8n2_250000_bother", 250000, 8, 'N', 2, false, false, false, false, true},
+      {"8e1_31250_bother", 31250, 8, 'E', 1, true, true, false, false, true},
+      {"low_latency_rejected", 19200, 8, 'N', 1, false, false, true, false, false},
+      {"rs485_rejected", 19200, 8, 'N', 1, false, false, false, true, false},
+  };
+
+  int failures = 0;
+  for (const Case &c : cases) {
+    SerialConfig cfg;
+    cfg.device = ::ptsname(master);
+    cfg.baudrate = c.baudrate;
+    cfg.data_bits = c.data_bits;
+    cfg.parity = c.parity;
+    cfg.stop_bits = c.stop_bits;
+    cfg.rtscts = c.rtscts;
+    cfg.xonxoff = c.xonxoff;
+    cfg.vmin = 0;
+    cfg.vtime_ds = 3;
+    cfg.low_latency = c.low_latency;
+    cfg.rs485.enabled = c.rs485;
+
+    SerialPort port;
+    const bool opened = port.Open(cfg);
+    std::string error;
+    bool ok = opened == c.expect_open;
+    if (!ok)
+      error = opened ? "Open() succeeded" : port.LastError();
+    else if (opened)
+      ok = VerifyTermios(port.Fd(), cfg, error);
+
+    std::printf("{\"name\":\"serial_check_%s\",\"ok\":%s}\n", c.name, ok ? "true" : "false");
+    if (!ok) {
+      std::fprintf(stderr, "serial_check_%s: %s\n", c.name, error.c_str());
+      ++failures;
+    }
+  }
+
+  ::close(master);
+  return failures == 0 ? 0 : 1;
+}
+
+Options ParseOptions(int argc, char **argv) {
+  Options options;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (arg == "--filter" && i + 1 < argc) {
+      options.filter = argv[++i];
+    } else if (arg == "--rounds" && i + 1 < argc) {
+      options.rounds = std::max(1, std::atoi(argv[++i]));
+    } else if (arg == "--check-alloc") {
+      options.check_alloc = true;
+    } else if (arg == "--check-serial") {
+      options.check_serial = true;
+    } else if (arg == "--frames" && i + 1 < argc) {
+      options.alloc_frames = std::strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--trace" && i + 1 < argc) {
+      options.trace_path = argv[++i];
+    } else {
+      std::fprintf(stderr, "Usage: %s [--filter SUBSTR] [--rounds N] [--trace FILE]\n"
+                           "       %s --check-alloc [--frames N]\n"
+                           "       %s --check-serial\n",
+                   argv[0], argv[0], argv[0]);
+      std::exit(2);
+    }
+  }
+  return options;
+}
+}  // namespace
+
+int main(int argc, char **argv) {
+  const Options options = ParseOptions(argc, argv);
+  if (options.check_alloc)
+    return CheckAllocations(options);
+  if (options.check_serial)
+    return CheckSerialConfig();
+
+  BenchParser(options, "parser_clean_chunk256", 0.0, kReadChunkBytes);
+  BenchParser(options, "parser_noisy30_chunk256", 0.3, kReadChunkBytes);
+  BenchParser(options, "parser_noisy80_chunk256", 0.8, kReadChunkBytes);
+  BenchParser(options, "parser_clean_chunk1", 0.0, 1);
+  BenchParser(options, "parser_burst_backlog_4000", 0.0, 4000);
+
+  BenchRingPushDrop(options);
+  BenchRingOverflow(options);
+  BenchRingCopyFront(options);
+
+  BenchScanner(options);
+
+  BenchChangeDetect(options);
+  BenchBatchDecode(options);
+
+  BenchReplay(options);
+
+  if (!options.trace_path.empty()) {
+    if (!kTraceCompiled) {
+      std::fprintf(stderr, "--trace: rebuild with -DLOADCELL_COMM_TRACE=ON\n");
+      return 1;
+    }
+    if (!WriteChromeTrace(options.trace_path)) {
+      std::fprintf(stderr, "--trace: cannot write %s\n", options.trace_path.c_str());
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,128 @@
+#ifndef FRAME_LAYOUT_H_
+#define FRAME_LAYOUT_H_
+
+#include "loadcell_status.h"
+#include "sync_scanner.h"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace loadcell_comm {
+// 컴파일 타임 프레임 레이아웃 기술자
+// - FrameField: 프레임 내 offset, 원시 정수 타입(폭/부호), 바이트 순서, 대상 LoadCellStatus 멤버
+// - FrameLayout: 헤더 3 bytes + 프레임 길이 + 필드 목록 → 필드별로 펼쳐진 Decode() 생성
+// - 범위/겹침/헤더 조건은 static_assert로 검사 (잘못된 레이아웃은 컴파일 오류)
+enum class ByteOrder { kBig, kLittle };
+
+namespace frame_layout_detail {
+template <typename T> struct MemberTraits;
+
+template <typename C, typename M> struct MemberTraits<M C::*> {
+  using Class = C;
+  using Type = M;
+};
+
+template <typename Raw, ByteOrder Order, std::size_t... I>
+constexpr Raw Load(const uint8_t *p, std::index_sequence<I...>) noexcept {
+  using U = std::make_unsigned_t<Raw>;
+  constexpr std::size_t kWidth = sizeof...(I);
+  U u = 0;
+  ((u |= static_cast<U>(static_cast<U>(p[I])
+                        << (8 * (Order == ByteOrder::kBig ? kWidth - 1 - I : I)))),
+   ...);
+  return static_cast<Raw>(u);
+}
+
+template <std::size_t N>
+constexpr bool Disjoint(const std::array<std::size_t, N> &offset,
+                        const std::array<std::size_t, N> &width) noexcept {
+  for (std::size_t i = 0; i < N; ++i)
+    for (std::size_t j = i + 1; j < N; ++j)
+      if (offset[i] < offset[j] + width[j] && offset[j] < offset[i] + width[i])
+        return false;
+  return true;
+}
+}  // namespace frame_layout_detail
+
+// Member: LoadCellStatus 멤버 포인터, Offset: 프레임 시작 기준 위치
+// Raw: 원시 정수 타입 (int32_t → 4 bytes 부호 있음, uint8_t → 1 byte 등)
+template <auto Member, std::size_t Offset, typename Raw,
+          ByteOrder Order = ByteOrder::kBig>
+struct FrameField {
+  using Traits = frame_layout_detail::MemberTraits<decltype(Member)>;
+  static_assert(std::is_same_v<typename Traits::Class, LoadCellStatus>,
+                "FrameField target must be a LoadCellStatus member");
+  static_assert(std::is_integral_v<Raw> && sizeof(Raw) <= 8,
+                "FrameField raw type must be an integer of at most 8 bytes");
+
+  static constexpr std::size_t kOffset = Offset;
+  static constexpr std::size_t kWidth = sizeof(Raw);
+
+  static void Decode(const uint8_t *frame, LoadCellStatus &out) noexcept {
+    const Raw raw = frame_layout_detail::Load<Raw, Order>(
+        frame + Offset, std::make_index_sequence<kWidth>{});
+    out.*Member = static_cast<typename Traits::Type>(raw);
+  }
+};
+
+template <uint8_t H0, uint8_t H1, uint8_t H2, std::size_t FrameBytes,
+          typename... Fields>
+struct FrameLayout {
+  static constexpr SyncPattern kHeader = {H0, H1, H2};
+  static constexpr std::size_t kFrameBytes = FrameBytes;
+
+  // FrameParser는 헤더 불일치 시 부분 헤더를 되돌아보지 않으므로
+  // 첫 바이트가 헤더 뒤쪽에 다시 나타나면 프레임을 놓칠 수 있음
+  static_assert(H0 != H1 && H0 != H2,
+                "header first byte must not repeat inside the header");
+  static_assert(FrameBytes >= kHeader.size(), "frame shorter than header");
+  static_assert(((Fields::kOffset >= kHeader.size()) && ...),
+                "field overlaps header");
+  static_assert(((Fields::kOffset + Fields::kWidth <= FrameBytes) && ...),
+                "field exceeds frame length");
+  static_assert(frame_layout_detail::Disjoint<sizeof...(Fields)>(
+                    {Fields::kOffset...}, {Fields::kWidth...}),
+                "fields overlap");
+
+  // 필드 수만큼 펼쳐진 디코더 (분기/루프 없음)
+  static void Decode(const uint8_t *frame, LoadCellStatus &out) noexcept {
+    (Fields::Decode(frame, out), ...);
+  }
+};
+
+// FrameParser/LoadCell485에 넘기는 런타임 기술자 (프레임당 간접 호출 1회)
+struct FrameProtocol {
+  SyncPattern header;
+  std::size_t frame_bytes;
+  void (*decode)(const uint8_t *frame, LoadCellStatus &out) noexcept;
+};
+
+template <typename Layout>
+constexpr FrameProtocol MakeFrameProtocol() noexcept {
+  return FrameProtocol{Layout::kHeader, Layout::kFrameBytes, &Layout::Decode};
+}
+
+// 기본 로드셀 프레임 (25 bytes)
+// [0..2] 헤더 0x55 0xAB 0x01, [4..15] 무게 3개 (int32 BE), [16..24] 상태 9 bytes
+using LoadCellFrameLayout = FrameLayout<
+    0x55, 0xAB, 0x01, 25,
+    FrameField<&LoadCellStatus::gross_weight, 4, int32_t>,
+    FrameField<&LoadCellStatus::right_weight, 8, int32_t>,
+    FrameField<&LoadCellStatus::left_weight, 12, int32_t>,
+    FrameField<&LoadCellStatus::right_battery_percent, 16, uint8_t>,
+    FrameField<&LoadCellStatus::right_charge_status, 17, uint8_t>,
+    FrameField<&LoadCellStatus::right_online_status, 18, uint8_t>,
+    FrameField<&LoadCellStatus::left_battery_percent, 19, uint8_t>,
+    FrameField<&LoadCellStatus::left_charge_status, 20, uint8_t>,
+    FrameField<&LoadCellStatus::left_online_status, 21, uint8_t>,
+    FrameField<&LoadCellStatus::gross_net_mark, 22, uint8_t>,
+    FrameField<&LoadCellStatus::overload_mark, 23, uint8_t>,
+    FrameField<&LoadCellStatus::out_of_tolerance_mark, 24, uint8_t>>;
+
+inline constexpr FrameProtocol kLoadCellFrameProtocol =
+    MakeFrameProtocol<LoadCellFrameLayout>();
+} // namespace loadcell_comm
+
+#endif // FRAME_LAYOUT_H_
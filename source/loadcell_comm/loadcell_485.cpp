@@ -1,172 +1,342 @@
 #include "loadcell_485.h"
-#include "ByteRingBuffer.h"
 #include "SerialPort.h"
+#include "loadcell_frame_parser.h"
 #include "loadcell_status.h"
+#include "loadcell_trace.h"
 #include <array>
 #include <cstddef>
-#include <vector>
+#include <time.h>
 
 namespace {
-constexpr std::size_t kRingBufferBytes = 2048;
+// 페이지 크기(4KiB) 배수 → 링버퍼가 커널 이중 매핑 사용
+constexpr std::size_t kRingBufferBytes = 4096;
 constexpr std::size_t kOneReadBytes = 256;
 
-constexpr uint8_t kHeader0 = 0x55;
-constexpr uint8_t kHeader1 = 0xAB;
-constexpr uint8_t kHeader2 = 0x01;
-
-constexpr std::size_t kMinFrameBytes = 25;
-
-constexpr std::size_t kHeader0Pos = 0;
-constexpr std::size_t kHeader1Pos = 1;
-constexpr std::size_t kHeader2Pos = 2;
-
-constexpr std::size_t kOffsetGross = 4;
-constexpr std::size_t kOffsetRight = 8;
-constexpr std::size_t kOffsetLeft = 12;
-
-constexpr std::size_t kOffsetRightBattery = 16;
-constexpr std::size_t kOffsetRightCharge = 17;
-constexpr std::size_t kOffsetRightOnline = 18;
-
-constexpr std::size_t kOffsetLeftBattery = 19;
-constexpr std::size_t kOffsetLeftCharge = 20;
-constexpr std::size_t kOffsetLeftOnline = 21;
-
-constexpr std::size_t kOffsetGrossNet = 22;
-constexpr std::size_t kOffsetOverload = 23;
-constexpr std::size_t kOffsetTolerance = 24;
-
-int32_t Read32BE_(const uint8_t* data) {
-  const uint32_t u =
-      (static_cast<uint32_t>(data[0]) << 24) |
-      (static_cast<uint32_t>(data[1]) << 16) |
-      (static_cast<uint32_t>(data[2]) << 8) |
-      static_cast<uint32_t>(data[3]);
-  return static_cast<int32_t>(u);
+int64_t MonotonicNs_() noexcept {
+  timespec ts{};
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
 }
-
 }  // namespace
 
 namespace loadcell_comm {
-LoadCell485::LoadCell485()
-    : serial_port_(std::make_unique<SerialPort>()),
-      ring_buffer_(std::make_unique<ByteRingBuffer>(kRingBufferBytes)) {}
+LoadCell485::LoadCell485() : LoadCell485(std::make_unique<SerialPort>()) {}
+
+LoadCell485::LoadCell485(std::unique_ptr<ByteTransport> transport)
+    : LoadCell485(std::move(transport), kLoadCellFrameProtocol) {}
+
+LoadCell485::LoadCell485(const FrameProtocol &protocol)
+    : LoadCell485(std::make_unique<SerialPort>(), protocol) {}
+
+LoadCell485::LoadCell485(std::unique_ptr<ByteTransport> transport,
+                         const FrameProtocol &protocol)
+    : transport_(std::move(transport)),
+      serial_port_(dynamic_cast<SerialPort *>(transport_.get())),
+      parser_(std::make_unique<FrameParser>(kRingBufferBytes, protocol)) {}
 
 LoadCell485::~LoadCell485() = default;
 
 bool LoadCell485::Open(const SerialConfig &cfg) {
+  if (!serial_port_) {
+    SetLastError("Open(cfg): transport is not a SerialPort");
+    return false;
+  }
+
   bool flag = serial_port_->Open(cfg);
-  if (!flag)
-    last_error_ = serial_port_->LastError();
+  if (!flag) {
+    SetLastError(serial_port_->LastError());
+  } else {
+    parser_->SetByteDurationNs(serial_port_->ByteDurationNs());
+    live_timestamps_ = serial_port_->LiveTimestamps();
+  }
+  LOADCELL_TRACE_PREPARE_THREAD();
 
   return flag;
 }
 
 bool LoadCell485::Open() {
-  bool flag = serial_port_->Open();
-  if (!flag)
-    last_error_ = serial_port_->LastError();
+  bool flag = transport_->Open();
+  if (!flag) {
+    SetLastError(transport_->LastError());
+  } else {
+    parser_->SetByteDurationNs(transport_->ByteDurationNs());
+    live_timestamps_ = transport_->LiveTimestamps();
+  }
+  LOADCELL_TRACE_PREPARE_THREAD();
 
   return flag;
 }
 
-void LoadCell485::Close() noexcept { serial_port_->Close(); }
+void LoadCell485::Close() noexcept { transport_->Close(); }
 
-bool LoadCell485::IsOpen() const noexcept { return serial_port_->IsOpen(); }
+bool LoadCell485::IsOpen() const noexcept { return transport_->IsOpen(); }
 
-ResultCode LoadCell485::RecvOnce(LoadCellStatus &out_status) {
-  std::array<uint8_t, kOneReadBytes> temp{};
-  const long read_bytes = serial_port_->Read(temp.data(), temp.size());
-  if (read_bytes < 0) {
-    last_error_ = serial_port_->LastError();
-    return ResultCode::kIoReadFail;
-  }
+int LoadCell485::NativeHandle() const noexcept { return transport_->Fd(); }
+
+void LoadCell485::ResetBuffer() noexcept {
+  parser_->Reset();
+  ResetSubscriptions();
+}
 
-  if (read_bytes > 0)
-    ring_buffer_->Push(temp.data(), static_cast<std::size_t>(read_bytes));
+ResultCode LoadCell485::RecvOnce(LoadCellStatus &out_status) noexcept {
+  LOADCELL_TRACE_SCOPE("RecvOnce");
+  const ResultCode read_result = ReadIntoBuffer_();
+  if (read_result != ResultCode::kOk)
+    return read_result;
 
   return TryParseOneFrame_(out_status);
 }
 
-const std::string &LoadCell485::GetLastError() const noexcept {
-  return last_error_;
+ResultCode LoadCell485::RecvUntil(std::chrono::steady_clock::time_point deadline,
+                                  LoadCellStatus &out_status) noexcept {
+  ResultCode rc = TryParseOneFrame_(out_status);
+  while (rc != ResultCode::kOk) {
+    std::array<uint8_t, kOneReadBytes> temp{};
+    long read_bytes = 0;
+    {
+      LOADCELL_TRACE_SCOPE("read_until");
+      read_bytes = transport_->ReadUntil(temp.data(), temp.size(), deadline);
+      LOADCELL_TRACE_ARG(read_bytes);
+    }
+    if (FeedRead_(temp.data(), read_bytes) != ResultCode::kOk)
+      return ResultCode::kIoReadFail;
+
+    if (read_bytes == 0) {
+      NoteError_(ResultCode::kTimeout, ErrorDetail::kDeadline);
+      return ResultCode::kTimeout;
+    }
+
+    rc = TryParseOneFrame_(out_status);
+  }
+
+  return rc;
 }
 
-ResultCode LoadCell485::TryParseOneFrame_(LoadCellStatus &out_status) {
-  const std::size_t buffer_size = ring_buffer_->Size();
-  if(buffer_size < kMinFrameBytes) {
-    SetLastError("Not enough data in buffer: (" + std::to_string(ring_buffer_->Size()) + " bytes)");
-    return ResultCode::kFrameTooShort;
+ResultCode LoadCell485::RecvFor(std::chrono::microseconds timeout,
+                                LoadCellStatus &out_status) noexcept {
+  return RecvUntil(std::chrono::steady_clock::now() + timeout, out_status);
+}
+
+ResultCode LoadCell485::RecvBatch(LoadCellStatus *out_status,
+                                  std::size_t capacity,
+                                  std::size_t &out_count) noexcept {
+  LOADCELL_TRACE_SCOPE("RecvBatch");
+  out_count = 0;
+
+  const ResultCode read_result = ReadIntoBuffer_();
+  if (read_result != ResultCode::kOk)
+    return read_result;
+
+  // 데이터 부족/헤더 미검출 또는 capacity 소진까지 반복
+  ResultCode rc = ResultCode::kFrameTooShort;
+  while (out_count < capacity) {
+    rc = TryParseOneFrame_(out_status[out_count]);
+    if (rc != ResultCode::kOk)
+      break;
+    ++out_count;
   }
 
-  // 임시 버퍼에 복사
-  std::vector<uint8_t> temp_buffer;
-  ring_buffer_->CopyFront(buffer_size, temp_buffer);
-
-  // 버퍼에서 헤더 영역 검색
-  const std::size_t headers_found = buffer_size - kMinFrameBytes + 1;
-  bool found = false;
-  std::size_t first_header_index = 0;
-  for (; first_header_index < headers_found; ++first_header_index) {
-    if(temp_buffer[first_header_index + kHeader0Pos] == kHeader0 &&
-       temp_buffer[first_header_index + kHeader1Pos] == kHeader1 &&
-       temp_buffer[first_header_index + kHeader2Pos] == kHeader2) {
-      found = true;
+  LOADCELL_TRACE_ARG(out_count);
+  return out_count > 0 ? ResultCode::kOk : rc;
+}
+
+ResultCode LoadCell485::RecvBatch(std::vector<LoadCellStatus> &out_status) {
+  out_status.clear();
+
+  const ResultCode read_result = ReadIntoBuffer_();
+  if (read_result != ResultCode::kOk)
+    return read_result;
+
+  ResultCode rc = ResultCode::kFrameTooShort;
+  LoadCellStatus status;
+  while ((rc = TryParseOneFrame_(status)) == ResultCode::kOk)
+    out_status.push_back(status);
+
+  return out_status.empty() ? rc : ResultCode::kOk;
+}
+
+ResultCode LoadCell485::RecvBatch(LoadCellRecord *out_record,
+                                  std::size_t capacity,
+                                  std::size_t &out_count) noexcept {
+  out_count = 0;
+
+  const ResultCode read_result = ReadIntoBuffer_();
+  if (read_result != ResultCode::kOk)
+    return read_result;
+
+  ResultCode rc = ResultCode::kFrameTooShort;
+  LoadCellStatus status;
+  while (out_count < capacity) {
+    rc = TryParseOneRaw_(status);
+    if (rc != ResultCode::kOk)
       break;
+    out_record[out_count++] = ToRecord(status);
+  }
+
+  return out_count > 0 ? ResultCode::kOk : rc;
+}
+
+void LoadCell485::SetCalibration(const Calibration &calibration) noexcept {
+  calibration_ = calibration;
+}
+
+const Calibration &LoadCell485::GetCalibration() const noexcept {
+  return calibration_;
+}
+
+int LoadCell485::Subscribe(const SubscriptionConfig &cfg,
+                           SubscriptionCallback callback) {
+  const int id = next_subscription_id_++;
+  subscribers_.push_back(Subscriber{id, ChangeDetector(cfg), std::move(callback)});
+  return id;
+}
+
+bool LoadCell485::Unsubscribe(int subscription_id) {
+  for (auto it = subscribers_.begin(); it != subscribers_.end(); ++it) {
+    if (it->id == subscription_id) {
+      subscribers_.erase(it);
+      return true;
     }
   }
+  return false;
+}
 
-  // 헤더 탐색 실패 시 헤더 탐색 영역만큼 버퍼 비우기
-  if (false == found) {
-    SetLastError("No valid header found in buffer");
-    ring_buffer_->DropFront(headers_found);
-    return ResultCode::kNoFrame;
+void LoadCell485::ResetSubscriptions() noexcept {
+  for (Subscriber &subscriber : subscribers_)
+    subscriber.detector.Reset();
+}
+
+ResultCode LoadCell485::ReadIntoBuffer_() noexcept {
+  std::array<uint8_t, kOneReadBytes> temp{};
+  long read_bytes = 0;
+  {
+    LOADCELL_TRACE_SCOPE("read");
+    read_bytes = transport_->Read(temp.data(), temp.size());
+    LOADCELL_TRACE_ARG(read_bytes);
   }
+  return FeedRead_(temp.data(), read_bytes);
+}
 
-  // 데이터 파싱
-  std::array<uint8_t, kMinFrameBytes> frames{};
-  std::copy(temp_buffer.begin() + first_header_index,
-            temp_buffer.begin() + first_header_index + kMinFrameBytes,
-            frames.begin());
-  ApplyScale(frames, out_status);
+ResultCode LoadCell485::FeedRead_(const uint8_t *data, long read_bytes) noexcept {
+  read_calls_.Add(1);
+  if (read_bytes < 0) {
+    read_errors_.Add(1);
+    NoteError_(ResultCode::kIoReadFail, ErrorDetail::kTransport);
+    return ResultCode::kIoReadFail;
+  }
 
-  // 프레임을 버퍼에서 제거
-  ring_buffer_->DropFront(first_header_index + kMinFrameBytes);
+  if (read_bytes > 0) {
+    LOADCELL_TRACE_SCOPE("push");
+    LOADCELL_TRACE_ARG(read_bytes);
+    bytes_read_.Add(static_cast<uint64_t>(read_bytes));
+    const ReadTimestamp &arrival = transport_->LastReadTime();
+    parser_->Feed(data, static_cast<std::size_t>(read_bytes),
+                  arrival.monotonic_ns, arrival.realtime_ns);
+  }
 
   return ResultCode::kOk;
 }
 
-void LoadCell485::ApplyScale(const std::array<uint8_t, kMinFrameBytes>& frame, LoadCellStatus &status) noexcept {
-  // weight: 4바이트 big-endian 정수로 디코딩
-  const int32_t gross = Read32BE_(frame.data() + kOffsetGross);
-  const int32_t right = Read32BE_(frame.data() + kOffsetRight);
-  const int32_t left = Read32BE_(frame.data() + kOffsetLeft);
+LoadCellStats LoadCell485::GetStats() const noexcept {
+  LoadCellStats stats;
+  stats.read_calls = read_calls_.Load();
+  stats.read_errors = read_errors_.Load();
+  stats.bytes_read = bytes_read_.Load();
+  stats.frames_decoded = frames_decoded_.Load();
+  parser_->CollectStats(stats);
+  return stats;
+}
 
-  // 현재: 스케일 미확정 → 단순 캐스팅
-  status.gross_weight = static_cast<double>(gross);
-  status.right_weight = static_cast<double>(right);
-  status.left_weight = static_cast<double>(left);
+LatencyHistogramSnapshot LoadCell485::GetLatencyHistogram() const noexcept {
+  return latency_.Snapshot();
+}
 
-  // 상태 필드
-  status.right_battery_percent = frame[kOffsetRightBattery];
-  status.right_charge_status = frame[kOffsetRightCharge];
-  status.right_online_status = frame[kOffsetRightOnline];
+const std::string &LoadCell485::GetLastError() const noexcept {
+  if (!error_pending_)
+    return last_error_;
 
-  status.left_battery_percent = frame[kOffsetLeftBattery];
-  status.left_charge_status = frame[kOffsetLeftCharge];
-  status.left_online_status = frame[kOffsetLeftOnline];
+  error_pending_ = false;
+  try {
+    switch (error_detail_) {
+    case ErrorDetail::kMessage:
+      break;
+    case ErrorDetail::kNoHeader:
+      last_error_ = "No valid header found in buffer";
+      break;
+    case ErrorDetail::kDeadline:
+      last_error_ = "No frame received before deadline";
+      break;
+    case ErrorDetail::kTransport:
+      last_error_ = transport_->LastError();
+      break;
+    }
+  } catch (...) {
+    // 메시지 생성 실패 시 이전 메시지 유지
+  }
+  return last_error_;
+}
+
+ResultCode LoadCell485::GetLastErrorCode() const noexcept {
+  return last_error_code_;
+}
 
-  status.gross_net_mark = frame[kOffsetGrossNet];
-  status.overload_mark = frame[kOffsetOverload];
-  status.out_of_tolerance_mark = frame[kOffsetTolerance];
+ResultCode LoadCell485::TryParseOneFrame_(LoadCellStatus &out_status) noexcept {
+  const ResultCode rc = TryParseOneRaw_(out_status);
+  if (rc == ResultCode::kOk)
+    calibration_.Apply(out_status);
 
-  // 문서에서 scale/offset 발견 시 여기만 수정:
-  // status.gross_weight = static_cast<double>(gross) * 0.1;
-  // status.gross_weight = (static_cast<double>(gross) - offset) * gain;
+  return rc;
+}
+
+ResultCode LoadCell485::TryParseOneRaw_(LoadCellStatus &out_status) noexcept {
+  const ResultCode rc = parser_->Next(out_status);
+  if (rc == ResultCode::kOk) {
+    frames_decoded_.Add(1);
+    // 캡처 시각을 재생하는 transport(kAsFastAsPossible)는 현재 시각과 비교할 수 없음
+    if (live_timestamps_ && out_status.monotonic_ns != 0)
+      latency_.Record(MonotonicNs_() - out_status.monotonic_ns);
+    if (!subscribers_.empty())
+      NotifySubscribers_(out_status);
+  }
+  // kNeedMoreData는 오류가 아니므로 기록하지 않음 (마지막 실제 오류 유지)
+  else if (rc == ResultCode::kNoFrame)
+    NoteError_(rc, ErrorDetail::kNoHeader);
+
+  return rc;
+}
+
+void LoadCell485::NotifySubscribers_(const LoadCellStatus &raw_status) noexcept {
+  const LoadCellRecord record = ToRecord(raw_status);
+  const int64_t now_ns = raw_status.monotonic_ns != 0 ? raw_status.monotonic_ns : MonotonicNs_();
+
+  // 보정은 통지할 구독자가 있을 때 1회만 수행
+  LoadCellStatus status;
+  bool calibrated = false;
+  for (Subscriber &subscriber : subscribers_) {
+    const uint8_t changes = subscriber.detector.Check(record, now_ns);
+    if (changes == 0)
+      continue;
+
+    if (!calibrated) {
+      status = raw_status;
+      calibration_.Apply(status);
+      calibrated = true;
+    }
+    if (subscriber.callback)
+      subscriber.callback(status, changes);
+  }
 }
 
 void LoadCell485::SetLastError(std::string msg) noexcept {
   last_error_ = std::move(msg);
+  error_detail_ = ErrorDetail::kMessage;
+  error_pending_ = false;
+}
+
+void LoadCell485::NoteError_(ResultCode code, ErrorDetail detail) noexcept {
+  last_error_code_ = code;
+  error_detail_ = detail;
+  error_pending_ = true;
 }
 
 } // namespace loadcell_comm
\ No newline at end of file
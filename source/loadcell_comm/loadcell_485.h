@@ -1,42 +1,139 @@
 #ifndef LOADCELL_485_H_
 #define LOADCELL_485_H_
 
+#include "frame_layout.h"
+#include "loadcell_record.h"
+#include "loadcell_stats.h"
 #include "loadcell_status.h"
+#include "loadcell_subscription.h"
+#include <chrono>
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <memory>
+#include <vector>
 
 class SerialConfig;
 class SerialPort;
-class ByteRingBuffer;
+class ByteTransport;
 
 namespace loadcell_comm {
+class FrameParser;
+
 class LoadCell485 {
 public:
+  // status: 보정 적용된 프레임, changes: ChangeMask 비트
+  using SubscriptionCallback = std::function<void(const LoadCellStatus &status, uint8_t changes)>;
+
+  // SerialPort 사용
   LoadCell485();
+  // 임의 transport 사용 (ReplayTransport, CaptureTap 등)
+  explicit LoadCell485(std::unique_ptr<ByteTransport> transport);
+  // 다른 프레임 레이아웃 장치: LoadCell485 lc(MakeFrameProtocol<MyLayout>());
+  // 직접 구성한 FrameProtocol이 FrameLayout 조건을 어기면 std::invalid_argument (FrameParser 참고)
+  explicit LoadCell485(const FrameProtocol &protocol);
+  LoadCell485(std::unique_ptr<ByteTransport> transport, const FrameProtocol &protocol);
   ~LoadCell485();
 
     LoadCell485(const LoadCell485 &) = delete;
     LoadCell485 &operator=(const LoadCell485 &) = delete;
 
+    // transport가 SerialPort일 때만 사용 가능
     bool Open(const SerialConfig &cfg);
     bool Open();
     void Close() noexcept;
     bool IsOpen() const noexcept;
+    // 열린 포트의 fd (epoll 등록용), 닫혀 있으면 -1
+    int NativeHandle() const noexcept;
+    // 버퍼에 남은 바이트/부분 프레임을 버리고 구독 기준값 초기화 (재연결 직후 등)
+    void ResetBuffer() noexcept;
+
+    ResultCode RecvOnce(LoadCellStatus &out_status) noexcept;
+
+    // deadline까지 프레임 1개 수신 대기 (non_blocking 모드 전용, ppoll 기반)
+    // 버퍼에 이미 프레임이 있으면 read 없이 즉시 반환, 기한 초과 시 kTimeout
+    ResultCode RecvUntil(std::chrono::steady_clock::time_point deadline,
+                         LoadCellStatus &out_status) noexcept;
+    ResultCode RecvFor(std::chrono::microseconds timeout,
+                       LoadCellStatus &out_status) noexcept;
+
+    // 1회 read 후 버퍼에 쌓인 완전한 프레임을 최대 capacity개까지 모두 디코딩
+    // RecvOnce/RecvUntil/RecvFor/RecvBatch(포인터)는 정상 수신 중 힙 할당/예외 없음
+    ResultCode RecvBatch(LoadCellStatus *out_status, std::size_t capacity,
+                         std::size_t &out_count) noexcept;
+    // out_status를 비우고 디코딩된 모든 프레임으로 채움 (기존 capacity 재사용)
+    ResultCode RecvBatch(std::vector<LoadCellStatus> &out_status);
+    // RecvBatch와 동일, 보정 전 raw count를 24 bytes 레코드로 반환 (수신 시각 제외)
+    ResultCode RecvBatch(LoadCellRecord *out_record, std::size_t capacity,
+                         std::size_t &out_count) noexcept;
+
+    // LoadCellStatus 반환 경로에 적용할 보정값 (기본: 항등), 수신 스레드에서 호출
+    void SetCalibration(const Calibration &calibration) noexcept;
+    const Calibration &GetCalibration() const noexcept;
 
-    ResultCode RecvOnce(LoadCellStatus &out_status);
+    // 변경 통지 구독: 모든 수신 함수에서 디코딩된 프레임마다 판정, 변화가 있을 때만 callback 호출
+    // - 수신 스레드에서 호출됨, 예외를 던지면 안 됨 (수신 경로는 noexcept)
+    // - Subscribe/Unsubscribe는 수신 스레드에서 호출 (callback 내부 호출 금지)
+    // 반환: 구독 id (Unsubscribe용, 1부터 증가)
+    int Subscribe(const SubscriptionConfig &cfg, SubscriptionCallback callback);
+    bool Unsubscribe(int subscription_id);
+    // 모든 구독의 기준값 초기화 → 다음 프레임은 kChangeFirst로 통지
+    void ResetSubscriptions() noexcept;
 
+    // 누적 수신 통계 (임의 스레드에서 호출 가능, 수신 경로에 영향 없음)
+    LoadCellStats GetStats() const noexcept;
+    // 프레임 마지막 바이트 수신 ~ 호출자에게 반환되기까지의 지연 분포
+    LatencyHistogramSnapshot GetLatencyHistogram() const noexcept;
+
+    // 상세 오류 메시지: 수신 경로는 오류 종류/값만 기록하고 메시지는 이 함수 호출 시 생성
     const std::string &GetLastError() const noexcept;
+    // 마지막 오류 결과 (kOk/kNeedMoreData 반환은 갱신하지 않음, 오류가 없었으면 kOk)
+    ResultCode GetLastErrorCode() const noexcept;
 
 private:
-    ResultCode TryParseOneFrame_(LoadCellStatus &out_status);
-    void ApplyScale(const std::array<uint8_t, 25>& frame, LoadCellStatus &status) noexcept;
+    // 수신 경로 오류 상세 (메시지 대신 기록)
+    enum class ErrorDetail : uint8_t {
+      kMessage,      // last_error_에 메시지가 이미 있음
+      kNoHeader,
+      kDeadline,
+      kTransport,    // transport_->LastError()
+    };
+
+    ResultCode ReadIntoBuffer_() noexcept;
+    ResultCode FeedRead_(const uint8_t *data, long read_bytes) noexcept;
+    ResultCode TryParseOneFrame_(LoadCellStatus &out_status) noexcept;
+    ResultCode TryParseOneRaw_(LoadCellStatus &out_status) noexcept;
+
+    void NotifySubscribers_(const LoadCellStatus &raw_status) noexcept;
 
     void SetLastError(std::string msg) noexcept;
+    void NoteError_(ResultCode code, ErrorDetail detail) noexcept;
 
 private:
-    std::unique_ptr<class SerialPort> serial_port_;
-    std::unique_ptr<class ByteRingBuffer> ring_buffer_;
-    std::string last_error_;
+    std::unique_ptr<ByteTransport> transport_;
+    // transport_가 SerialPort인 경우의 별칭 (비소유), 아니면 nullptr
+    SerialPort *serial_port_ = nullptr;
+    std::unique_ptr<FrameParser> parser_;
+    Calibration calibration_;
+
+    struct Subscriber {
+      int id = 0;
+      ChangeDetector detector;
+      SubscriptionCallback callback;
+    };
+    std::vector<Subscriber> subscribers_;
+    int next_subscription_id_ = 1;
+    mutable std::string last_error_;
+    mutable bool error_pending_ = false; // detail이 아직 메시지로 변환되지 않음
+    ErrorDetail error_detail_ = ErrorDetail::kMessage;
+    ResultCode last_error_code_ = ResultCode::kOk;
+
+    StatCounter read_calls_;
+    StatCounter read_errors_;
+    StatCounter bytes_read_;
+    StatCounter frames_decoded_;
+    LatencyHistogram latency_;
+    bool live_timestamps_ = true; // Open() 시 transport_->LiveTimestamps()
 };
 }
 
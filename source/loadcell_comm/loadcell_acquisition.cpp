@@ -0,0 +1,148 @@
+#include "loadcell_acquisition.h"
+#include "SerialConfig.h"
+#include "SpscQueue.h"
+#include "loadcell_485.h"
+#include "loadcell_filter.h"
+#include "loadcell_trace.h"
+#include "seqlock_slot.h"
+#include <array>
+
+namespace {
+constexpr std::size_t kBatchFrames = 32;
+
+const std::string &NoError() noexcept {
+  static const std::string empty;
+  return empty;
+}
+}  // namespace
+
+namespace loadcell_comm {
+LoadCellAcquisition::LoadCellAcquisition(std::size_t queue_frames)
+    : loadcell_(std::make_unique<LoadCell485>()),
+      queue_(std::make_unique<SpscQueue<LoadCellStatus>>(queue_frames)),
+      latest_(std::make_unique<SeqLockSlot<LoadCellStatus>>()) {}
+
+LoadCellAcquisition::~LoadCellAcquisition() { Stop(); }
+
+bool LoadCellAcquisition::SetFilter(const FilterChainConfig &cfg) {
+  if (IsRunning())
+    return false;
+
+  filter_ = std::make_unique<LoadCellFilter>(cfg);
+  return true;
+}
+
+void LoadCellAcquisition::ClearFilter() noexcept {
+  if (!IsRunning())
+    filter_.reset();
+}
+
+bool LoadCellAcquisition::IsStable() const noexcept {
+  return stable_.load(std::memory_order_relaxed);
+}
+
+bool LoadCellAcquisition::Start(const SerialConfig &cfg) {
+  Stop();
+
+  SerialConfig acquisition_cfg = cfg;
+  acquisition_cfg.vmin = 0;
+  if (acquisition_cfg.vtime_ds == 0)
+    acquisition_cfg.vtime_ds = 1;
+  // non-blocking이면 read가 즉시 반환되어 수신 스레드가 코어 1개를 점유
+  acquisition_cfg.non_blocking = false;
+
+  if (!loadcell_->Open(acquisition_cfg)) {
+    last_error_code_.store(ResultCode::kIoReadFail, std::memory_order_relaxed);
+    return false;
+  }
+
+  // 이전 실행의 프레임 제거 (수신 스레드 종료 후이므로 producer 없음)
+  LoadCellStatus stale;
+  while (queue_->TryPop(stale)) {
+  }
+
+  last_error_code_.store(ResultCode::kOk, std::memory_order_relaxed);
+  stable_.store(false, std::memory_order_relaxed);
+  if (filter_)
+    filter_->Reset();
+  stop_requested_.store(false, std::memory_order_relaxed);
+  running_.store(true, std::memory_order_release);
+  worker_ = std::thread(&LoadCellAcquisition::RunLoop_, this);
+  return true;
+}
+
+void LoadCellAcquisition::Stop() noexcept {
+  stop_requested_.store(true, std::memory_order_relaxed);
+  if (worker_.joinable())
+    worker_.join();
+
+  running_.store(false, std::memory_order_release);
+  loadcell_->Close();
+}
+
+bool LoadCellAcquisition::IsRunning() const noexcept {
+  return running_.load(std::memory_order_acquire);
+}
+
+bool LoadCellAcquisition::PopFrame(LoadCellStatus &out_status) noexcept {
+  return queue_->TryPop(out_status);
+}
+
+std::size_t LoadCellAcquisition::PopFrames(LoadCellStatus *out_status,
+                                           std::size_t capacity) noexcept {
+  return queue_->TryPopBulk(out_status, capacity);
+}
+
+bool LoadCellAcquisition::LatestStatus(LoadCellStatus &out_status,
+                                       uint64_t *out_sequence) const noexcept {
+  return latest_->Load(out_status, out_sequence);
+}
+
+uint64_t LoadCellAcquisition::DroppedFrames() const noexcept {
+  return dropped_frames_.load(std::memory_order_relaxed);
+}
+
+LoadCellStats LoadCellAcquisition::GetStats() const noexcept {
+  return loadcell_->GetStats();
+}
+
+ResultCode LoadCellAcquisition::GetLastErrorCode() const noexcept {
+  return last_error_code_.load(std::memory_order_acquire);
+}
+
+const std::string &LoadCellAcquisition::GetLastError() const noexcept {
+  if (GetLastErrorCode() == ResultCode::kOk)
+    return NoError();
+  return loadcell_->GetLastError();
+}
+
+void LoadCellAcquisition::RunLoop_() noexcept {
+  LOADCELL_TRACE_THREAD_NAME("loadcell_acquisition");
+  std::array<LoadCellStatus, kBatchFrames> batch{};
+
+  while (!stop_requested_.load(std::memory_order_relaxed)) {
+    std::size_t count = 0;
+    const ResultCode rc = loadcell_->RecvBatch(batch.data(), batch.size(), count);
+    if (rc == ResultCode::kIoReadFail) {
+      last_error_code_.store(rc, std::memory_order_release);
+      break;
+    }
+
+    if (filter_ && count > 0) {
+      filter_->ApplyBatch(batch.data(), count);
+      stable_.store(filter_->IsStable(), std::memory_order_relaxed);
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+      if (!queue_->TryPush(batch[i]))
+        dropped_frames_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // 최신값은 배치의 마지막 프레임만 반영
+    if (count > 0)
+      latest_->Store(batch[count - 1]);
+  }
+
+  running_.store(false, std::memory_order_release);
+}
+} // namespace loadcell_comm
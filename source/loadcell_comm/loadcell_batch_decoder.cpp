@@ -0,0 +1,266 @@
+#include "loadcell_batch_decoder.h"
+#include "frame_layout.h"
+#include <array>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LOADCELL_BATCH_DECODER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+using loadcell_comm::ByteOrder;
+using loadcell_comm::DecodeBackend;
+using loadcell_comm::FrameColumns;
+
+// LoadCellFrameLayout: [4..15] gross/right/left int32 BE, [16..24] 상태 9 bytes
+constexpr std::size_t kFrameBytes = 25;
+constexpr std::size_t kWeightOffset = 4;
+constexpr std::size_t kStatusOffset = 16;
+constexpr std::size_t kStatusBytes = 9;
+static_assert(loadcell_comm::LoadCellFrameLayout::kFrameBytes == kFrameBytes,
+              "batch decoder assumes the default 25-byte frame");
+
+struct Coefficients {
+  double scale[3];
+  double bias[3];
+};
+
+int32_t Read32BE_(const uint8_t *p) noexcept {
+  return loadcell_comm::frame_layout_detail::Load<int32_t, ByteOrder::kBig>(
+      p, std::make_index_sequence<4>{});
+}
+
+// frames[begin..count) 무게 열
+void DecodeWeightsScalar_(const uint8_t *frames, std::size_t begin, std::size_t count,
+                          const FrameColumns &out, const Coefficients &k) noexcept {
+  for (std::size_t i = begin; i < count; ++i) {
+    const uint8_t *weights = frames + i * kFrameBytes + kWeightOffset;
+    const int32_t gross = Read32BE_(weights);
+    const int32_t right = Read32BE_(weights + 4);
+    const int32_t left = Read32BE_(weights + 8);
+
+    if (out.gross_raw)
+      out.gross_raw[i] = gross;
+    if (out.right_raw)
+      out.right_raw[i] = right;
+    if (out.left_raw)
+      out.left_raw[i] = left;
+
+    if (out.gross_weight)
+      out.gross_weight[i] = static_cast<float>(static_cast<double>(gross) * k.scale[0] + k.bias[0]);
+    if (out.right_weight)
+      out.right_weight[i] = static_cast<float>(static_cast<double>(right) * k.scale[1] + k.bias[1]);
+    if (out.left_weight)
+      out.left_weight[i] = static_cast<float>(static_cast<double>(left) * k.scale[2] + k.bias[2]);
+  }
+}
+
+using StatusColumns = std::array<uint8_t *, kStatusBytes>;
+
+StatusColumns StatusColumnsOf_(const FrameColumns &out) noexcept {
+  return {out.right_battery_percent, out.right_charge_status, out.right_online_status,
+          out.left_battery_percent,  out.left_charge_status,  out.left_online_status,
+          out.gross_net_mark,        out.overload_mark,       out.out_of_tolerance_mark};
+}
+
+bool HasWeightColumns_(const FrameColumns &out) noexcept {
+  return out.gross_raw || out.right_raw || out.left_raw || out.gross_weight ||
+         out.right_weight || out.left_weight;
+}
+
+bool HasStatusColumns_(const StatusColumns &columns) noexcept {
+  for (uint8_t *column : columns) {
+    if (column)
+      return true;
+  }
+  return false;
+}
+
+// frames[begin..count) 상태 바이트 열 (열마다 25 bytes 간격 gather, 요청된 열만)
+void DecodeStatusScalar_(const uint8_t *frames, std::size_t begin, std::size_t count,
+                         const StatusColumns &columns) noexcept {
+  for (std::size_t c = 0; c < kStatusBytes; ++c) {
+    uint8_t *column = columns[c];
+    if (!column)
+      continue;
+
+    const uint8_t *src = frames + kStatusOffset + c;
+    for (std::size_t i = begin; i < count; ++i)
+      column[i] = src[i * kFrameBytes];
+  }
+}
+
+#if LOADCELL_BATCH_DECODER_X86
+// 한 채널 4개 프레임 값 저장 (raw int32, 보정 float)
+__attribute__((target("ssse3")))
+inline void StoreChannel_(__m128i raw, std::size_t i, int32_t *raw_column,
+                          float *weight_column, double scale, double bias) noexcept {
+  if (raw_column)
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(raw_column + i), raw);
+
+  if (weight_column) {
+    // Calibration::Apply와 같은 double 연산 후 float 변환
+    const __m128d s = _mm_set1_pd(scale);
+    const __m128d b = _mm_set1_pd(bias);
+    const __m128d lo = _mm_add_pd(_mm_mul_pd(_mm_cvtepi32_pd(raw), s), b);
+    const __m128d hi = _mm_add_pd(
+        _mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(raw, _MM_SHUFFLE(3, 2, 3, 2))), s), b);
+    _mm_storeu_ps(weight_column + i, _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi)));
+  }
+}
+
+__attribute__((target("ssse3")))
+void DecodeWeightsSsse3_(const uint8_t *frames, std::size_t count, const FrameColumns &out,
+                         const Coefficients &k) noexcept {
+  // 프레임 bytes [4..19] → 32bit lane별 byte 역순: [gross, right, left, (상태 4 bytes, 미사용)]
+  const __m128i swap = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+
+  std::size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const uint8_t *weights = frames + i * kFrameBytes + kWeightOffset;
+    const __m128i f0 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights)), swap);
+    const __m128i f1 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights + kFrameBytes)), swap);
+    const __m128i f2 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights + 2 * kFrameBytes)), swap);
+    const __m128i f3 = _mm_shuffle_epi8(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(weights + 3 * kFrameBytes)), swap);
+
+    // 4x4 전치 → 채널별 4개 프레임
+    const __m128i gr01 = _mm_unpacklo_epi32(f0, f1); // g0 g1 r0 r1
+    const __m128i gr23 = _mm_unpacklo_epi32(f2, f3); // g2 g3 r2 r3
+    const __m128i lx01 = _mm_unpackhi_epi32(f0, f1); // l0 l1 x0 x1
+    const __m128i lx23 = _mm_unpackhi_epi32(f2, f3); // l2 l3 x2 x3
+
+    StoreChannel_(_mm_unpacklo_epi64(gr01, gr23), i, out.gross_raw, out.gross_weight,
+                  k.scale[0], k.bias[0]);
+    StoreChannel_(_mm_unpackhi_epi64(gr01, gr23), i, out.right_raw, out.right_weight,
+                  k.scale[1], k.bias[1]);
+    StoreChannel_(_mm_unpacklo_epi64(lx01, lx23), i, out.left_raw, out.left_weight,
+                  k.scale[2], k.bias[2]);
+  }
+
+  DecodeWeightsScalar_(frames, i, count, out, k);
+}
+
+// 프레임 16개의 마지막 16 bytes ([9..24], 상태는 lane 7..15)를 16x16 byte 전치
+// → 상태 열마다 프레임 16개를 store 1회로 기록
+__attribute__((target("ssse3")))
+void DecodeStatusSsse3_(const uint8_t *frames, std::size_t count,
+                        const StatusColumns &columns) noexcept {
+  constexpr std::size_t kLanes = 16;
+  constexpr std::size_t kTailOffset = kFrameBytes - kLanes;
+  constexpr std::size_t kFirstStatusLane = kStatusOffset - kTailOffset;
+
+  std::size_t i = 0;
+  for (; i + kLanes <= count; i += kLanes) {
+    __m128i rows[kLanes];
+    for (std::size_t r = 0; r < kLanes; ++r)
+      rows[r] = _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(frames + (i + r) * kFrameBytes + kTailOffset));
+
+    // (k, k+8) 행 interleave 4회 = 16x16 전치
+    for (int round = 0; round < 4; ++round) {
+      __m128i next[kLanes];
+      for (std::size_t r = 0; r < kLanes / 2; ++r) {
+        next[2 * r] = _mm_unpacklo_epi8(rows[r], rows[r + kLanes / 2]);
+        next[2 * r + 1] = _mm_unpackhi_epi8(rows[r], rows[r + kLanes / 2]);
+      }
+      for (std::size_t r = 0; r < kLanes; ++r)
+        rows[r] = next[r];
+    }
+
+    for (std::size_t c = 0; c < kStatusBytes; ++c) {
+      if (columns[c])
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(columns[c] + i),
+                         rows[kFirstStatusLane + c]);
+    }
+  }
+
+  DecodeStatusScalar_(frames, i, count, columns);
+}
+#endif
+
+DecodeBackend DetectBackend_() noexcept {
+#if LOADCELL_BATCH_DECODER_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("ssse3"))
+    return DecodeBackend::kSsse3;
+#endif
+  return DecodeBackend::kScalar;
+}
+
+void Dispatch_(DecodeBackend backend, const uint8_t *frames, std::size_t count,
+               const FrameColumns &out, const loadcell_comm::Calibration &calibration) noexcept {
+  const StatusColumns status_columns = StatusColumnsOf_(out);
+  const bool weights = HasWeightColumns_(out);
+  const bool status = HasStatusColumns_(status_columns);
+  Coefficients k{};
+  calibration.Coefficients(k.scale, k.bias);
+
+  switch (backend) {
+#if LOADCELL_BATCH_DECODER_X86
+  case DecodeBackend::kSsse3:
+    if (weights)
+      DecodeWeightsSsse3_(frames, count, out, k);
+    if (status)
+      DecodeStatusSsse3_(frames, count, status_columns);
+    break;
+#endif
+  case DecodeBackend::kScalar:
+  default:
+    if (weights)
+      DecodeWeightsScalar_(frames, 0, count, out, k);
+    if (status)
+      DecodeStatusScalar_(frames, 0, count, status_columns);
+    break;
+  }
+}
+}  // namespace
+
+namespace loadcell_comm {
+void DecodeFrameBatch(const uint8_t *frames, std::size_t count, const FrameColumns &out,
+                      const Calibration &calibration) noexcept {
+  Dispatch_(ActiveDecodeBackend(), frames, count, out, calibration);
+}
+
+void DecodeFrameBatchWith(DecodeBackend backend, const uint8_t *frames, std::size_t count,
+                          const FrameColumns &out, const Calibration &calibration) noexcept {
+  if (!IsDecodeBackendSupported(backend))
+    backend = DecodeBackend::kScalar;
+
+  Dispatch_(backend, frames, count, out, calibration);
+}
+
+bool IsDecodeBackendSupported(DecodeBackend backend) noexcept {
+  switch (backend) {
+  case DecodeBackend::kScalar:
+    return true;
+#if LOADCELL_BATCH_DECODER_X86
+  case DecodeBackend::kSsse3:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("ssse3");
+#endif
+  default:
+    return false;
+  }
+}
+
+DecodeBackend ActiveDecodeBackend() noexcept {
+  static const DecodeBackend backend = DetectBackend_();
+  return backend;
+}
+
+const char *DecodeBackendName(DecodeBackend backend) noexcept {
+  switch (backend) {
+  case DecodeBackend::kScalar:
+    return "scalar";
+  case DecodeBackend::kSsse3:
+    return "ssse3";
+  default:
+    return "unknown";
+  }
+}
+} // namespace loadcell_comm
@@ -0,0 +1,335 @@
+#include "loadcell_bus.h"
+#include "SerialConfig.h"
+#include "SerialPort.h"
+#include "loadcell_frame_parser.h"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <thread>
+#include <time.h>
+
+namespace {
+constexpr std::size_t kParserBufferBytes = 1024;
+constexpr std::size_t kMaxRequestBytes = 32;
+constexpr std::size_t kOneReadBytes = 256;
+// fd가 없는 transport의 송신 재시도 간격
+constexpr std::chrono::microseconds kWriteRetryInterval{100};
+
+std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+}  // namespace
+
+namespace loadcell_comm {
+struct LoadCellBus::Device {
+  BusDeviceConfig cfg;
+  std::unique_ptr<FrameParser> parser;
+  BusDeviceStats stats;
+
+  explicit Device(const BusDeviceConfig &device_cfg) : cfg(device_cfg) {
+    // 응답 헤더 = 0x55 0xAB address, 필드 배치는 기본 프레임과 동일
+    FrameProtocol protocol = kLoadCellFrameProtocol;
+    protocol.header[2] = device_cfg.address;
+    parser = std::make_unique<FrameParser>(kParserBufferBytes, protocol);
+  }
+};
+
+LoadCellBus::LoadCellBus(const BusConfig &bus_cfg)
+    : LoadCellBus(std::make_unique<SerialPort>(), bus_cfg) {}
+
+LoadCellBus::LoadCellBus(std::unique_ptr<ByteTransport> transport,
+                         const BusConfig &bus_cfg)
+    : transport_(std::move(transport)), bus_cfg_(bus_cfg) {}
+
+LoadCellBus::~LoadCellBus() { Close(); }
+
+bool LoadCellBus::Open(const SerialConfig &cfg) {
+  if (!HasEncoder_())
+    return false;
+
+  auto *serial_port = dynamic_cast<SerialPort *>(transport_.get());
+  if (!serial_port) {
+    last_error_ = "Open(cfg): transport is not a SerialPort";
+    return false;
+  }
+
+  SerialConfig bus_cfg = cfg;
+  bus_cfg.non_blocking = true;
+  bus_cfg.vmin = 0;
+  bus_cfg.vtime_ds = 0;
+
+  if (!serial_port->Open(bus_cfg)) {
+    last_error_ = serial_port->LastError();
+    return false;
+  }
+
+  bus_idle_since_ = std::chrono::steady_clock::now();
+  return true;
+}
+
+bool LoadCellBus::Open() {
+  if (!HasEncoder_())
+    return false;
+
+  if (!transport_->Open()) {
+    last_error_ = transport_->LastError();
+    return false;
+  }
+
+  bus_idle_since_ = std::chrono::steady_clock::now();
+  return true;
+}
+
+void LoadCellBus::Close() noexcept { transport_->Close(); }
+
+bool LoadCellBus::IsOpen() const noexcept { return transport_->IsOpen(); }
+
+bool LoadCellBus::AddDevice(const BusDeviceConfig &cfg) {
+  if (cfg.address == kLoadCellFrameProtocol.header[0]) {
+    last_error_ = "AddDevice(): address 0x55 collides with the frame header";
+    return false;
+  }
+  if (FindDevice_(cfg.address) != nullptr) {
+    last_error_ = "AddDevice(): duplicate address " + std::to_string(cfg.address);
+    return false;
+  }
+
+  devices_.push_back(std::make_unique<Device>(cfg));
+  return true;
+}
+
+bool LoadCellBus::RemoveDevice(uint8_t address) {
+  const auto it = std::find_if(devices_.begin(), devices_.end(),
+                               [address](const std::unique_ptr<Device> &device) {
+                                 return device->cfg.address == address;
+                               });
+  if (it == devices_.end())
+    return false;
+
+  devices_.erase(it);
+  return true;
+}
+
+std::size_t LoadCellBus::DeviceCount() const noexcept { return devices_.size(); }
+
+bool LoadCellBus::GetDeviceStats(uint8_t address,
+                                 BusDeviceStats &out_stats) const noexcept {
+  for (const auto &device : devices_) {
+    if (device->cfg.address == address) {
+      out_stats = device->stats;
+      return true;
+    }
+  }
+  return false;
+}
+
+ResultCode LoadCellBus::Transact(uint8_t address, BusCommand command,
+                                 LoadCellStatus &out_status) {
+  Device *device = FindDevice_(address);
+  if (device == nullptr) {
+    last_error_ = "Transact(): unknown address " + std::to_string(address);
+    return ResultCode::kInvalidArgument;
+  }
+  if (!HasEncoder_())
+    return ResultCode::kInvalidArgument;
+
+  for (unsigned attempt = 0; attempt <= device->cfg.retries; ++attempt) {
+    const ResultCode rc =
+        Attempt_(*device, command, device->cfg.response_timeout, out_status);
+    if (rc != ResultCode::kTimeout)
+      return rc;
+  }
+
+  ++device->stats.failures;
+  return ResultCode::kTimeout;
+}
+
+int LoadCellBus::PollCycle(const ResultCallback &callback) {
+  int responded = 0;
+  LoadCellStatus status;
+
+  for (const auto &device : devices_) {
+    const ResultCode rc = Transact(device->cfg.address, BusCommand::kPoll, status);
+    if (rc == ResultCode::kIoReadFail || rc == ResultCode::kInvalidArgument)
+      return -1;
+
+    if (rc == ResultCode::kOk)
+      ++responded;
+    if (callback)
+      callback(device->cfg.address, rc, status);
+  }
+
+  return responded;
+}
+
+std::vector<uint8_t> LoadCellBus::ScanAddresses(uint8_t first, uint8_t last,
+                                                std::chrono::microseconds timeout) {
+  std::vector<uint8_t> found;
+  LoadCellStatus status;
+  last_error_.clear();
+  if (!HasEncoder_())
+    return found;
+
+  for (unsigned address = first; address <= last; ++address) {
+    if (address == kLoadCellFrameProtocol.header[0])
+      continue;
+
+    BusDeviceConfig probe_cfg;
+    probe_cfg.address = static_cast<uint8_t>(address);
+    Device probe(probe_cfg);
+
+    const ResultCode rc = Attempt_(probe, BusCommand::kAddressQuery, timeout, status);
+    // 송수신 오류, 인코더 오류(kAddressQuery 미지원 등)는 중단 (last_error_ 유지)
+    if (rc == ResultCode::kIoReadFail || rc == ResultCode::kInvalidArgument)
+      break;
+    if (rc == ResultCode::kOk)
+      found.push_back(probe_cfg.address);
+  }
+
+  return found;
+}
+
+std::chrono::nanoseconds LoadCellBus::InterFrameGap() const noexcept {
+  const double gap_ns =
+      bus_cfg_.inter_frame_gap_chars * static_cast<double>(transport_->ByteDurationNs());
+  return std::chrono::nanoseconds(static_cast<int64_t>(gap_ns));
+}
+
+const std::string &LoadCellBus::GetLastError() const noexcept {
+  return last_error_;
+}
+
+LoadCellBus::Device *LoadCellBus::FindDevice_(uint8_t address) noexcept {
+  for (const auto &device : devices_) {
+    if (device->cfg.address == address)
+      return device.get();
+  }
+  return nullptr;
+}
+
+ResultCode LoadCellBus::Attempt_(Device &device, BusCommand command,
+                                 std::chrono::microseconds timeout,
+                                 LoadCellStatus &out_status) {
+  std::array<uint8_t, kMaxRequestBytes> request{};
+  const std::size_t request_bytes =
+      bus_cfg_.encoder(device.cfg.address, command, request.data(), request.size());
+  // 인코더가 명령을 지원하지 않거나 길이가 잘못된 경우: 설정 오류이므로 송신하지 않음
+  if (request_bytes == 0 || request_bytes > request.size()) {
+    last_error_ = "BusConfig::encoder returned " + std::to_string(request_bytes) +
+                  " bytes for command " + std::to_string(static_cast<unsigned>(command)) +
+                  " (capacity " + std::to_string(request.size()) + ")";
+    return ResultCode::kInvalidArgument;
+  }
+
+  // 이전 응답/타임아웃 이후 inter-frame gap 확보
+  std::this_thread::sleep_until(bus_idle_since_ + InterFrameGap());
+
+  // 이전 요청의 늦은 응답은 다른 주소 헤더이므로 파서가 폐기, 같은 주소의 잔여분만 초기화
+  device.parser->Reset();
+  device.parser->SetByteDurationNs(transport_->ByteDurationNs());
+
+  // 요청 송신 + 응답 프레임 전송 시간은 타임아웃과 별도로 가산
+  // (송신 큐가 밀려 있으면 그 대기 시간도 같은 기한 안에서 소비)
+  const int64_t wire_ns = static_cast<int64_t>(request_bytes + FrameParser::kFrameBytes) *
+                          transport_->ByteDurationNs();
+  const auto deadline = std::chrono::steady_clock::now() +
+                        std::chrono::nanoseconds(wire_ns) + timeout;
+
+  const ResultCode write_rc = WriteAll_(request.data(), request_bytes, deadline);
+  if (write_rc == ResultCode::kTimeout) {
+    ++device.stats.timeouts;
+    last_error_ = "Request to address " + std::to_string(device.cfg.address) +
+                  " not sent before deadline (tx queue full)";
+    bus_idle_since_ = std::chrono::steady_clock::now();
+    return ResultCode::kTimeout;
+  }
+  if (write_rc != ResultCode::kOk)
+    return write_rc;
+  ++device.stats.requests;
+
+  std::array<uint8_t, kOneReadBytes> temp{};
+  while (true) {
+    if (device.parser->Next(out_status) == ResultCode::kOk) {
+      ++device.stats.responses;
+      bus_idle_since_ = std::chrono::steady_clock::now();
+      return ResultCode::kOk;
+    }
+
+    const long read_bytes = transport_->ReadUntil(temp.data(), temp.size(), deadline);
+    if (read_bytes < 0) {
+      last_error_ = transport_->LastError();
+      bus_idle_since_ = std::chrono::steady_clock::now();
+      return ResultCode::kIoReadFail;
+    }
+
+    if (read_bytes == 0) {
+      ++device.stats.timeouts;
+      last_error_ = "No response from address " + std::to_string(device.cfg.address);
+      bus_idle_since_ = std::chrono::steady_clock::now();
+      return ResultCode::kTimeout;
+    }
+
+    const ReadTimestamp &arrival = transport_->LastReadTime();
+    device.parser->Feed(temp.data(), static_cast<std::size_t>(read_bytes),
+                        arrival.monotonic_ns, arrival.realtime_ns);
+  }
+}
+
+bool LoadCellBus::HasEncoder_() {
+  if (bus_cfg_.encoder != nullptr)
+    return true;
+
+  last_error_ = "BusConfig::encoder is not set (request format is device specific)";
+  return false;
+}
+
+ResultCode LoadCellBus::WriteAll_(const uint8_t *data, std::size_t size,
+                                  std::chrono::steady_clock::time_point deadline) {
+  while (size > 0) {
+    const long written = transport_->Write(data, size);
+    if (written < 0) {
+      last_error_ = transport_->LastError();
+      return ResultCode::kIoReadFail;
+    }
+    if (written > 0) {
+      data += written;
+      size -= static_cast<std::size_t>(written);
+      continue;
+    }
+
+    // 송신 큐 가득 참 (non-blocking): 기한까지 POLLOUT 대기 후 재시도
+    const auto now = std::chrono::steady_clock::now();
+    if (now >= deadline)
+      return ResultCode::kTimeout;
+
+    const int fd = transport_->Fd();
+    if (fd < 0) {
+      std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+          kWriteRetryInterval, deadline - now));
+      continue;
+    }
+
+    const auto remain_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(remain_ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(remain_ns % 1000000000LL);
+
+    pollfd pfd{};
+    pfd.fd = fd;
+    pfd.events = POLLOUT;
+    const int ready = ::ppoll(&pfd, 1, &ts, nullptr);
+    if (ready < 0 && errno != EINTR) {
+      last_error_ = SysErr("ppoll");
+      return ResultCode::kIoReadFail;
+    }
+    if (ready > 0 && (pfd.revents & (POLLHUP | POLLERR | POLLNVAL))) {
+      last_error_ = "ppoll: device hang-up or error while sending";
+      return ResultCode::kIoReadFail;
+    }
+  }
+  return ResultCode::kOk;
+}
+} // namespace loadcell_comm
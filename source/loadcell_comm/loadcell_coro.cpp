@@ -0,0 +1,373 @@
+#include "loadcell_coro.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+constexpr int kMaxEvents = 16;
+using Clock = std::chrono::steady_clock;
+
+std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+
+Clock::time_point DeadlineAfter(std::chrono::microseconds timeout) noexcept {
+  return timeout.count() < 0 ? Clock::time_point::max() : Clock::now() + timeout;
+}
+}  // namespace
+
+namespace loadcell_comm {
+// ---------------- CancelToken ----------------
+void CancelToken::Cancel() noexcept {
+  cancelled_.store(true, std::memory_order_release);
+  if (LoadCellReactor *reactor = reactor_.load(std::memory_order_acquire))
+    reactor->Wake();
+}
+
+// ---------------- LoadCellReactor ----------------
+LoadCellReactor::LoadCellReactor() {
+  epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd_ < 0)
+    throw std::runtime_error(SysErr("epoll_create1"));
+
+  wake_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wake_fd_ < 0) {
+    const std::string error = SysErr("eventfd");
+    ::close(epoll_fd_);
+    throw std::runtime_error(error);
+  }
+
+  // data.ptr == nullptr 은 wake 이벤트
+  epoll_event ev{};
+  ev.events = EPOLLIN;
+  ev.data.ptr = nullptr;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &ev) != 0) {
+    const std::string error = SysErr("epoll_ctl(eventfd)");
+    ::close(wake_fd_);
+    ::close(epoll_fd_);
+    throw std::runtime_error(error);
+  }
+}
+
+LoadCellReactor::~LoadCellReactor() {
+  // 남은 대기 항목은 재개하지 않음 (코루틴 프레임 소유자가 정리)
+  for (coro_detail::Waiter *waiter : waiters_) {
+    waiter->registered = false;
+    if (waiter->token != nullptr)
+      waiter->token->reactor_.store(nullptr, std::memory_order_release);
+  }
+  ::close(wake_fd_);
+  ::close(epoll_fd_);
+}
+
+int LoadCellReactor::RunOnce(std::chrono::microseconds timeout) {
+  // 이미 기한이 지났거나 취소된 항목은 대기 없이 처리
+  int resumed = ExpireAndCancel_();
+
+  Clock::time_point wake_at = DeadlineAfter(timeout);
+  for (const coro_detail::Waiter *waiter : waiters_)
+    wake_at = std::min(wake_at, waiter->deadline);
+
+  timespec ts{};
+  timespec *ts_ptr = nullptr;
+  if (resumed > 0) {
+    ts_ptr = &ts;
+  } else if (wake_at != Clock::time_point::max()) {
+    const auto left = std::max(Clock::duration::zero(), wake_at - Clock::now());
+    const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(left).count();
+    ts.tv_sec = static_cast<time_t>(ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(ns % 1000000000LL);
+    ts_ptr = &ts;
+  }
+
+  // epoll fd를 ppoll로 대기 (마이크로초 단위 기한)
+  pollfd pfd{epoll_fd_, POLLIN, 0};
+  if (::ppoll(&pfd, 1, ts_ptr, nullptr) < 0 && errno != EINTR) {
+    last_error_ = SysErr("ppoll");
+    return -1;
+  }
+
+  epoll_event events[kMaxEvents];
+  const int n = ::epoll_wait(epoll_fd_, events, kMaxEvents, 0);
+  if (n < 0 && errno != EINTR) {
+    last_error_ = SysErr("epoll_wait");
+    return -1;
+  }
+
+  for (int i = 0; i < n; ++i) {
+    auto *waiter = static_cast<coro_detail::Waiter *>(events[i].data.ptr);
+    if (waiter == nullptr) {
+      uint64_t value = 0;
+      (void)::read(wake_fd_, &value, sizeof(value));
+      continue;
+    }
+
+    // 앞선 재개에서 해제된 항목
+    if (std::find(waiters_.begin(), waiters_.end(), waiter) == waiters_.end())
+      continue;
+
+    const bool hang_up = (events[i].events & (EPOLLHUP | EPOLLERR)) != 0;
+    if (waiter->OnReadable(hang_up)) {
+      Resume_(*waiter);
+      ++resumed;
+    } else if (!Rearm_(*waiter)) {
+      waiter->Complete(AwaitResult::kIoReadFail);
+      Resume_(*waiter);
+      ++resumed;
+    }
+  }
+
+  return resumed + ExpireAndCancel_();
+}
+
+bool LoadCellReactor::Run() {
+  // 진입 시 초기화하지 않음: Run() 시작 전에 호출된 Stop()도 유효, 요청은 종료 시 소비
+  while (!stop_requested_.exchange(false, std::memory_order_relaxed) && !waiters_.empty()) {
+    if (RunOnce(std::chrono::microseconds(-1)) < 0)
+      return false;
+  }
+  return true;
+}
+
+void LoadCellReactor::Stop() noexcept {
+  stop_requested_.store(true, std::memory_order_relaxed);
+  Wake();
+}
+
+void LoadCellReactor::Wake() noexcept {
+  const uint64_t one = 1;
+  (void)::write(wake_fd_, &one, sizeof(one));
+}
+
+bool LoadCellReactor::Register_(coro_detail::Waiter &waiter) noexcept {
+  epoll_event ev{};
+  ev.events = EPOLLIN | EPOLLONESHOT;
+  ev.data.ptr = &waiter;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, waiter.fd, &ev) != 0) {
+    // EEXIST: 같은 fd를 다른 코루틴이 이미 대기 중
+    last_error_ = SysErr("epoll_ctl(ADD)");
+    return false;
+  }
+
+  try {
+    waiters_.push_back(&waiter);
+  } catch (...) {
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, waiter.fd, nullptr);
+    last_error_ = "Register(): out of memory";
+    return false;
+  }
+
+  waiter.reactor = this;
+  waiter.registered = true;
+  if (waiter.token != nullptr)
+    waiter.token->reactor_.store(this, std::memory_order_release);
+  return true;
+}
+
+bool LoadCellReactor::Rearm_(coro_detail::Waiter &waiter) noexcept {
+  epoll_event ev{};
+  ev.events = EPOLLIN | EPOLLONESHOT;
+  ev.data.ptr = &waiter;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_MOD, waiter.fd, &ev) != 0) {
+    last_error_ = SysErr("epoll_ctl(MOD)");
+    return false;
+  }
+  return true;
+}
+
+void LoadCellReactor::Unregister_(coro_detail::Waiter &waiter) noexcept {
+  if (!waiter.registered)
+    return;
+
+  ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, waiter.fd, nullptr);
+  waiters_.erase(std::remove(waiters_.begin(), waiters_.end(), &waiter), waiters_.end());
+  waiter.registered = false;
+  if (waiter.token != nullptr)
+    DetachToken_(*waiter.token);
+}
+
+void LoadCellReactor::DetachToken_(CancelToken &token) noexcept {
+  // 같은 토큰으로 대기 중인 항목이 남아 있으면 유지
+  for (const coro_detail::Waiter *other : waiters_) {
+    if (other->token == &token)
+      return;
+  }
+
+  // 대기 종료 후 reactor가 소멸되어도 Cancel()이 해제된 reactor를 깨우지 않도록 해제
+  LoadCellReactor *expected = this;
+  token.reactor_.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+}
+
+void LoadCellReactor::Resume_(coro_detail::Waiter &waiter) noexcept {
+  Unregister_(waiter);
+  // 재개 후 awaiter는 소멸될 수 있으므로 handle을 먼저 꺼냄
+  const std::coroutine_handle<> handle = waiter.handle;
+  handle.resume();
+}
+
+int LoadCellReactor::ExpireAndCancel_() noexcept {
+  int resumed = 0;
+
+  // 재개된 코루틴이 대기 목록을 바꿀 수 있으므로 항목 하나 처리 후 다시 탐색
+  while (true) {
+    const Clock::time_point now = Clock::now();
+    coro_detail::Waiter *target = nullptr;
+    AwaitResult result = AwaitResult::kTimeout;
+
+    for (coro_detail::Waiter *waiter : waiters_) {
+      if (waiter->token != nullptr && waiter->token->IsCancelled()) {
+        target = waiter;
+        result = AwaitResult::kCancelled;
+        break;
+      }
+      if (waiter->deadline <= now) {
+        target = waiter;
+        result = AwaitResult::kTimeout;
+        break;
+      }
+    }
+
+    if (target == nullptr)
+      return resumed;
+
+    target->Complete(result);
+    Resume_(*target);
+    ++resumed;
+  }
+}
+
+// ---------------- NextFrameAwaiter ----------------
+NextFrameAwaiter::NextFrameAwaiter(LoadCellReactor &reactor, LoadCell485 &loadcell,
+                                   LoadCellStatus &out_status,
+                                   std::chrono::microseconds timeout,
+                                   CancelToken *token) noexcept
+    : loadcell_(loadcell), out_status_(out_status), timeout_(timeout) {
+  this->reactor = &reactor;
+  this->token = token;
+}
+
+NextFrameAwaiter::~NextFrameAwaiter() {
+  if (registered)
+    reactor->Unregister_(*this);
+}
+
+bool NextFrameAwaiter::await_ready() noexcept {
+  if (token != nullptr && token->IsCancelled()) {
+    result_ = AwaitResult::kCancelled;
+    return true;
+  }
+  return TryReceive_();
+}
+
+bool NextFrameAwaiter::await_suspend(std::coroutine_handle<> handle) noexcept {
+  if (timeout_.count() == 0) {
+    result_ = AwaitResult::kTimeout;
+    return false;
+  }
+
+  this->handle = handle;
+  fd = loadcell_.NativeHandle();
+  deadline = DeadlineAfter(timeout_);
+  if (!reactor->Register_(*this)) {
+    result_ = AwaitResult::kIoReadFail;
+    return false;
+  }
+  return true;
+}
+
+bool NextFrameAwaiter::OnReadable(bool hang_up) noexcept {
+  if (TryReceive_())
+    return true;
+
+  if (hang_up) {
+    result_ = AwaitResult::kIoReadFail;
+    return true;
+  }
+  return false;
+}
+
+bool NextFrameAwaiter::TryReceive_() noexcept {
+  switch (loadcell_.RecvOnce(out_status_)) {
+  case ResultCode::kOk:
+    result_ = AwaitResult::kOk;
+    return true;
+  case ResultCode::kIoReadFail:
+    result_ = AwaitResult::kIoReadFail;
+    return true;
+  default:
+    return false;
+  }
+}
+
+// ---------------- NextBatchAwaiter ----------------
+NextBatchAwaiter::NextBatchAwaiter(LoadCellReactor &reactor, LoadCell485 &loadcell,
+                                   LoadCellStatus *out_status, std::size_t capacity,
+                                   std::size_t &out_count,
+                                   std::chrono::microseconds timeout,
+                                   CancelToken *token) noexcept
+    : loadcell_(loadcell), out_status_(out_status), capacity_(capacity),
+      out_count_(out_count), timeout_(timeout) {
+  this->reactor = &reactor;
+  this->token = token;
+  out_count_ = 0;
+}
+
+NextBatchAwaiter::~NextBatchAwaiter() {
+  if (registered)
+    reactor->Unregister_(*this);
+}
+
+bool NextBatchAwaiter::await_ready() noexcept {
+  if (token != nullptr && token->IsCancelled()) {
+    result_ = AwaitResult::kCancelled;
+    return true;
+  }
+  return TryReceive_();
+}
+
+bool NextBatchAwaiter::await_suspend(std::coroutine_handle<> handle) noexcept {
+  if (timeout_.count() == 0) {
+    result_ = AwaitResult::kTimeout;
+    return false;
+  }
+
+  this->handle = handle;
+  fd = loadcell_.NativeHandle();
+  deadline = DeadlineAfter(timeout_);
+  if (!reactor->Register_(*this)) {
+    result_ = AwaitResult::kIoReadFail;
+    return false;
+  }
+  return true;
+}
+
+bool NextBatchAwaiter::OnReadable(bool hang_up) noexcept {
+  if (TryReceive_())
+    return true;
+
+  if (hang_up) {
+    result_ = AwaitResult::kIoReadFail;
+    return true;
+  }
+  return false;
+}
+
+bool NextBatchAwaiter::TryReceive_() noexcept {
+  switch (loadcell_.RecvBatch(out_status_, capacity_, out_count_)) {
+  case ResultCode::kOk:
+    result_ = AwaitResult::kOk;
+    return true;
+  case ResultCode::kIoReadFail:
+    result_ = AwaitResult::kIoReadFail;
+    return true;
+  default:
+    return false;
+  }
+}
+} // namespace loadcell_comm
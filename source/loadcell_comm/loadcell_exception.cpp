@@ -26,6 +26,10 @@ LoadCell485Exception::code_to_string(ResultCode code) const noexcept {
     return "No Frame";
   case ResultCode::kIoReadFail:
     return "IO Read Fail";
+  case ResultCode::kTimeout:
+    return "Timeout";
+  case ResultCode::kInvalidArgument:
+    return "Invalid Argument";
   default:
     return "Unknown Error: " + std::to_string(static_cast<int>(code));
   }
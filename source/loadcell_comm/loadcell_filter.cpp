@@ -0,0 +1,290 @@
+#include "loadcell_filter.h"
+#include <algorithm>
+#include <string>
+#include <stdexcept>
+
+namespace {
+void RequireWindow(std::size_t window, const char *who) {
+  if (window == 0)
+    throw std::invalid_argument(std::string(who) + ": window must be > 0");
+}
+}  // namespace
+
+namespace loadcell_comm {
+// ---------------- MovingAverageFilter ----------------
+MovingAverageFilter::MovingAverageFilter(std::size_t window) {
+  RequireWindow(window, "MovingAverageFilter");
+  ring_.assign(window, 0.0);
+}
+
+double MovingAverageFilter::Update(double x) noexcept {
+  if (filled_ < ring_.size()) {
+    ++filled_;
+    sum_ += x;
+  } else {
+    sum_ += x - ring_[head_];
+  }
+  ring_[head_] = x;
+
+  if (++head_ == ring_.size()) {
+    head_ = 0;
+    // 한 바퀴마다 합 재계산 (샘플당 O(1) 상각)
+    if (filled_ == ring_.size()) {
+      double sum = 0.0;
+      for (const double v : ring_)
+        sum += v;
+      sum_ = sum;
+    }
+  }
+
+  return sum_ / static_cast<double>(filled_);
+}
+
+void MovingAverageFilter::Process(const double *in, double *out,
+                                  std::size_t count) noexcept {
+  for (std::size_t i = 0; i < count; ++i)
+    out[i] = Update(in[i]);
+}
+
+void MovingAverageFilter::Reset() noexcept {
+  head_ = 0;
+  filled_ = 0;
+  sum_ = 0.0;
+}
+
+// ---------------- EmaFilter ----------------
+EmaFilter::EmaFilter(double alpha) : alpha_(alpha) {
+  if (!(alpha > 0.0 && alpha <= 1.0))
+    throw std::invalid_argument("EmaFilter: alpha must be in (0, 1]");
+}
+
+double EmaFilter::Update(double x) noexcept {
+  if (!primed_) {
+    y_ = x;
+    primed_ = true;
+  } else {
+    y_ += alpha_ * (x - y_);
+  }
+  return y_;
+}
+
+void EmaFilter::Process(const double *in, double *out, std::size_t count) noexcept {
+  for (std::size_t i = 0; i < count; ++i)
+    out[i] = Update(in[i]);
+}
+
+void EmaFilter::Reset() noexcept {
+  y_ = 0.0;
+  primed_ = false;
+}
+
+// ---------------- MedianFilter ----------------
+MedianFilter::MedianFilter(std::size_t window) {
+  RequireWindow(window, "MedianFilter");
+  ring_.assign(window, 0.0);
+  sorted_.assign(window, 0.0);
+}
+
+double MedianFilter::Update(double x) noexcept {
+  double *begin = sorted_.data();
+
+  if (filled_ == ring_.size()) {
+    // 가장 오래된 샘플 제거
+    double *old = std::lower_bound(begin, begin + filled_, ring_[head_]);
+    std::copy(old + 1, begin + filled_, old);
+    --filled_;
+  }
+
+  double *pos = std::upper_bound(begin, begin + filled_, x);
+  std::copy_backward(pos, begin + filled_, begin + filled_ + 1);
+  *pos = x;
+  ++filled_;
+
+  ring_[head_] = x;
+  if (++head_ == ring_.size())
+    head_ = 0;
+
+  const std::size_t mid = filled_ / 2;
+  return (filled_ & 1) ? begin[mid] : 0.5 * (begin[mid - 1] + begin[mid]);
+}
+
+void MedianFilter::Process(const double *in, double *out, std::size_t count) noexcept {
+  for (std::size_t i = 0; i < count; ++i)
+    out[i] = Update(in[i]);
+}
+
+void MedianFilter::Reset() noexcept {
+  head_ = 0;
+  filled_ = 0;
+}
+
+// ---------------- KalmanFilter ----------------
+KalmanFilter::KalmanFilter(double process_noise, double measurement_noise)
+    : q_(process_noise), r_(measurement_noise) {
+  if (!(process_noise >= 0.0) || !(measurement_noise > 0.0))
+    throw std::invalid_argument("KalmanFilter: invalid noise parameters");
+}
+
+double KalmanFilter::Update(double x) noexcept {
+  if (!primed_) {
+    x_ = x;
+    p_ = r_;
+    primed_ = true;
+    return x_;
+  }
+
+  // 예측: 무게 유지, 불확실성 증가 → 보정
+  p_ += q_;
+  const double k = p_ / (p_ + r_);
+  x_ += k * (x - x_);
+  p_ *= 1.0 - k;
+  return x_;
+}
+
+void KalmanFilter::Process(const double *in, double *out, std::size_t count) noexcept {
+  for (std::size_t i = 0; i < count; ++i)
+    out[i] = Update(in[i]);
+}
+
+void KalmanFilter::Reset() noexcept {
+  x_ = 0.0;
+  p_ = 0.0;
+  primed_ = false;
+}
+
+// ---------------- StabilityDetector ----------------
+StabilityDetector::StabilityDetector(std::size_t window, double max_variance)
+    : max_variance_(max_variance) {
+  RequireWindow(window, "StabilityDetector");
+  ring_.assign(window, 0.0);
+}
+
+bool StabilityDetector::Update(double x) noexcept {
+  if (filled_ == 0)
+    reference_ = x;
+
+  const double d = x - reference_;
+  if (filled_ < ring_.size()) {
+    ++filled_;
+  } else {
+    const double old = ring_[head_];
+    sum_ -= old;
+    sum_sq_ -= old * old;
+  }
+  sum_ += d;
+  sum_sq_ += d * d;
+  ring_[head_] = d;
+
+  if (++head_ == ring_.size()) {
+    head_ = 0;
+    // 한 바퀴마다 기준값을 현재 평균으로 옮기고 합을 재계산
+    const double shift = sum_ / static_cast<double>(filled_);
+    reference_ += shift;
+    sum_ = 0.0;
+    sum_sq_ = 0.0;
+    for (std::size_t i = 0; i < filled_; ++i) {
+      ring_[i] -= shift;
+      sum_ += ring_[i];
+      sum_sq_ += ring_[i] * ring_[i];
+    }
+  }
+
+  stable_ = filled_ == ring_.size() && Variance() <= max_variance_;
+  return stable_;
+}
+
+double StabilityDetector::Variance() const noexcept {
+  if (filled_ == 0)
+    return 0.0;
+
+  const double n = static_cast<double>(filled_);
+  const double mean = sum_ / n;
+  return std::max(0.0, sum_sq_ / n - mean * mean);
+}
+
+void StabilityDetector::Reset() noexcept {
+  head_ = 0;
+  filled_ = 0;
+  reference_ = 0.0;
+  sum_ = 0.0;
+  sum_sq_ = 0.0;
+  stable_ = false;
+}
+
+// ---------------- FilterChain ----------------
+FilterChain::FilterChain(const FilterChainConfig &cfg)
+    : stability_(cfg.stable_window, cfg.stable_variance) {
+  stages_.reserve(cfg.stages.size());
+  for (const FilterStageConfig &stage : cfg.stages) {
+    switch (stage.kind) {
+    case FilterKind::kMovingAverage:
+      stages_.emplace_back(MovingAverageFilter(stage.window));
+      break;
+    case FilterKind::kEma:
+      stages_.emplace_back(EmaFilter(stage.alpha));
+      break;
+    case FilterKind::kMedian:
+      stages_.emplace_back(MedianFilter(stage.window));
+      break;
+    case FilterKind::kKalman:
+      stages_.emplace_back(KalmanFilter(stage.process_noise, stage.measurement_noise));
+      break;
+    }
+  }
+}
+
+double FilterChain::Update(double x) noexcept {
+  for (Stage &stage : stages_)
+    x = std::visit([x](auto &filter) noexcept { return filter.Update(x); }, stage);
+
+  stability_.Update(x);
+  return x;
+}
+
+void FilterChain::Process(const double *in, double *out, std::size_t count) noexcept {
+  // 단계별로 배열 전체를 처리 (단계 분기는 배열당 1회)
+  for (Stage &stage : stages_) {
+    std::visit([&](auto &filter) noexcept { filter.Process(in, out, count); }, stage);
+    in = out;
+  }
+
+  if (stages_.empty() && in != out)
+    std::copy(in, in + count, out);
+
+  for (std::size_t i = 0; i < count; ++i)
+    stability_.Update(out[i]);
+}
+
+void FilterChain::Reset() noexcept {
+  for (Stage &stage : stages_)
+    std::visit([](auto &filter) noexcept { filter.Reset(); }, stage);
+  stability_.Reset();
+}
+
+// ---------------- LoadCellFilter ----------------
+LoadCellFilter::LoadCellFilter(const FilterChainConfig &cfg)
+    : gross_(cfg), right_(cfg), left_(cfg) {}
+
+bool LoadCellFilter::Apply(LoadCellStatus &status) noexcept {
+  status.gross_weight = gross_.Update(status.gross_weight);
+  status.right_weight = right_.Update(status.right_weight);
+  status.left_weight = left_.Update(status.left_weight);
+  return gross_.IsStable();
+}
+
+void LoadCellFilter::ApplyBatch(LoadCellStatus *status, std::size_t count,
+                                uint8_t *out_stable) noexcept {
+  // 3채널은 서로 독립 → 한 프레임에서 함께 갱신하여 의존 체인을 겹쳐 실행
+  for (std::size_t i = 0; i < count; ++i) {
+    const bool stable = Apply(status[i]);
+    if (out_stable != nullptr)
+      out_stable[i] = stable ? 1 : 0;
+  }
+}
+
+void LoadCellFilter::Reset() noexcept {
+  gross_.Reset();
+  right_.Reset();
+  left_.Reset();
+}
+} // namespace loadcell_comm
@@ -0,0 +1,159 @@
+#ifndef LOADCELL_FILTER_H_
+#define LOADCELL_FILTER_H_
+
+#include "loadcell_status.h"
+#include <cstddef>
+#include <cstdint>
+#include <variant>
+#include <vector>
+
+namespace loadcell_comm {
+// 무게 신호 필터 (채널 1개, 샘플 단위 갱신)
+// - 생성 시 필요한 버퍼를 모두 할당, 이후 Update()/Process()는 할당 없음
+// - Process(): 배열 단위 처리 (in == out 허용)
+
+// 단순 이동 평균: 누적 합 갱신 O(1), 버퍼 한 바퀴마다 합을 다시 계산해 오차 누적 방지
+class MovingAverageFilter {
+public:
+  explicit MovingAverageFilter(std::size_t window);
+
+    double Update(double x) noexcept;
+    void Process(const double *in, double *out, std::size_t count) noexcept;
+    void Reset() noexcept;
+
+private:
+    std::vector<double> ring_;
+    std::size_t head_ = 0;
+    std::size_t filled_ = 0;
+    double sum_ = 0.0;
+};
+
+// 지수 이동 평균: y += alpha * (x - y), 첫 샘플로 초기화
+class EmaFilter {
+public:
+  explicit EmaFilter(double alpha);
+
+    double Update(double x) noexcept;
+    void Process(const double *in, double *out, std::size_t count) noexcept;
+    void Reset() noexcept;
+
+private:
+    double alpha_;
+    double y_ = 0.0;
+    bool primed_ = false;
+};
+
+// 이동 중앙값: 정렬된 window 유지 (이분 탐색 + 이동, window 크기에 선형)
+// 스파이크 제거용, window는 작게(≤ 64) 사용
+class MedianFilter {
+public:
+  explicit MedianFilter(std::size_t window);
+
+    double Update(double x) noexcept;
+    void Process(const double *in, double *out, std::size_t count) noexcept;
+    void Reset() noexcept;
+
+private:
+    std::vector<double> ring_;   // 입력 순서
+    std::vector<double> sorted_; // 정렬 상태, 앞쪽 filled_개 유효
+    std::size_t head_ = 0;
+    std::size_t filled_ = 0;
+};
+
+// 1차 Kalman 필터 (상수 무게 모델)
+// process_noise: 샘플당 실제 무게 변화 분산, measurement_noise: 측정 잡음 분산
+class KalmanFilter {
+public:
+  KalmanFilter(double process_noise, double measurement_noise);
+
+    double Update(double x) noexcept;
+    void Process(const double *in, double *out, std::size_t count) noexcept;
+    void Reset() noexcept;
+
+private:
+    double q_;
+    double r_;
+    double x_ = 0.0;
+    double p_ = 0.0;
+    bool primed_ = false;
+};
+
+// 안정 판정: 최근 window개 샘플의 분산 ≤ max_variance
+// 누적 합/제곱합 O(1) 갱신 (첫 샘플 기준으로 이동시켜 상쇄 오차 완화)
+class StabilityDetector {
+public:
+  StabilityDetector(std::size_t window, double max_variance);
+
+    bool Update(double x) noexcept;
+    bool IsStable() const noexcept { return stable_; }
+    double Variance() const noexcept;
+    void Reset() noexcept;
+
+private:
+    std::vector<double> ring_; // 기준값을 뺀 샘플
+    std::size_t head_ = 0;
+    std::size_t filled_ = 0;
+    double reference_ = 0.0;
+    double sum_ = 0.0;
+    double sum_sq_ = 0.0;
+    double max_variance_;
+    bool stable_ = false;
+};
+
+enum class FilterKind { kMovingAverage, kEma, kMedian, kKalman };
+
+struct FilterStageConfig {
+  FilterKind kind = FilterKind::kMovingAverage;
+  std::size_t window = 8;          // kMovingAverage, kMedian
+  double alpha = 0.2;              // kEma
+  double process_noise = 1e-3;     // kKalman
+  double measurement_noise = 1.0;  // kKalman
+};
+
+struct FilterChainConfig {
+  std::vector<FilterStageConfig> stages; // 순서대로 적용 (비어 있으면 통과)
+  std::size_t stable_window = 16;        // 안정 판정 샘플 수
+  double stable_variance = 1.0;          // 안정 판정 분산 상한 (무게 단위²)
+};
+
+// 채널 1개용 필터 체인 + 안정 판정 (판정은 필터 출력 기준)
+class FilterChain {
+public:
+  explicit FilterChain(const FilterChainConfig &cfg);
+
+    double Update(double x) noexcept;
+    void Process(const double *in, double *out, std::size_t count) noexcept;
+    bool IsStable() const noexcept { return stability_.IsStable(); }
+    void Reset() noexcept;
+
+private:
+    using Stage = std::variant<MovingAverageFilter, EmaFilter, MedianFilter, KalmanFilter>;
+
+    std::vector<Stage> stages_;
+    StabilityDetector stability_;
+};
+
+// gross/right/left 3채널 필터
+class LoadCellFilter {
+public:
+  explicit LoadCellFilter(const FilterChainConfig &cfg);
+
+    // 무게 3개를 필터 출력으로 대체, 반환: gross 채널 안정 여부
+    bool Apply(LoadCellStatus &status) noexcept;
+    // count개 프레임 처리, out_stable(nullptr 허용)에 프레임별 gross 안정 여부(0/1) 기록
+    void ApplyBatch(LoadCellStatus *status, std::size_t count,
+                    uint8_t *out_stable = nullptr) noexcept;
+
+    bool IsStable() const noexcept { return gross_.IsStable(); }
+    bool IsRightStable() const noexcept { return right_.IsStable(); }
+    bool IsLeftStable() const noexcept { return left_.IsStable(); }
+    void Reset() noexcept;
+
+private:
+    FilterChain gross_;
+    FilterChain right_;
+    FilterChain left_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_FILTER_H_
@@ -0,0 +1,167 @@
+#include "loadcell_frame_parser.h"
+#include "ByteRingBuffer.h"
+#include "loadcell_trace.h"
+#include "sync_scanner.h"
+#include <array>
+#include <stdexcept>
+
+namespace {
+// 헤더 크기 - 1: 버퍼 끝에 걸친 부분 헤더 최대 길이
+constexpr std::size_t kPartialHeaderBytes = std::tuple_size<loadcell_comm::SyncPattern>::value - 1;
+}  // namespace
+
+namespace loadcell_comm {
+FrameParser::FrameParser(std::size_t buffer_bytes, const FrameProtocol &protocol)
+    : ring_buffer_(std::make_unique<ByteRingBuffer>(buffer_bytes)),
+      protocol_(protocol) {
+  if (protocol_.decode == nullptr || protocol_.frame_bytes > ring_buffer_->Capacity())
+    throw std::invalid_argument("FrameParser: invalid frame protocol");
+
+  // 직접 구성한 FrameProtocol은 FrameLayout의 static_assert를 거치지 않으므로 같은 조건을 여기서 검사
+  const SyncPattern &header = protocol_.header;
+  if (protocol_.frame_bytes < header.size())
+    throw std::invalid_argument("FrameParser: frame shorter than header");
+  // Next()의 부분 헤더 재동기화는 헤더 자기 겹침이 없다고 가정
+  if (header[0] == header[1] || header[0] == header[2])
+    throw std::invalid_argument("FrameParser: header first byte must not repeat inside the header");
+}
+
+FrameParser::~FrameParser() = default;
+
+std::size_t FrameParser::Feed(const uint8_t *data, std::size_t size,
+                              int64_t arrival_monotonic_ns,
+                              int64_t arrival_realtime_ns) {
+  const std::size_t dropped = ring_buffer_->Push(data, size);
+  newest_monotonic_ns_ = arrival_monotonic_ns;
+  newest_realtime_ns_ = arrival_realtime_ns;
+
+  // 앞쪽이 버려졌으면 링버퍼 앞쪽은 더 이상 후보 프레임 시작이 아님
+  if (dropped > 0) {
+    overflow_events_.Add(1);
+    overflow_bytes_.Add(dropped);
+    state_ = State::kHuntHeader;
+    matched_ = 0;
+  }
+
+  return dropped;
+}
+
+void FrameParser::SetByteDurationNs(int64_t byte_duration_ns) noexcept {
+  byte_duration_ns_ = byte_duration_ns;
+}
+
+ResultCode FrameParser::Next(LoadCellStatus &out_status) noexcept {
+  const ByteSpan front = ring_buffer_->Front();
+  const uint8_t *data = front.data;
+
+  // [0, start): 폐기할 비-헤더 바이트, [start, start + matched_): 현재 후보
+  std::size_t start = 0;
+  std::size_t pos = matched_;
+
+  while (pos < front.size) {
+    if (state_ == State::kHuntHeader) {
+      if (matched_ == 0) {
+        // 헤더 전체 일치 위치를 SIMD 스캐너로 한 번에 탐색
+        const std::size_t remain = front.size - pos;
+        std::size_t hit = 0;
+        {
+          LOADCELL_TRACE_SCOPE("sync");
+          LOADCELL_TRACE_ARG(remain);
+          hit = FindSyncPattern(data + pos, remain, protocol_.header);
+        }
+        if (hit < remain) {
+          start = pos + hit;
+          pos = start + protocol_.header.size();
+          matched_ = protocol_.header.size();
+          state_ = State::kCollectPayload;
+          continue;
+        }
+
+        // 끝부분(2바이트 이하)은 부분 헤더일 수 있으므로 아래 바이트 단위 비교로 처리
+        if (remain > kPartialHeaderBytes)
+          start = pos = front.size - kPartialHeaderBytes;
+      }
+
+      if (data[pos] == protocol_.header[matched_]) {
+        ++matched_;
+        ++pos;
+        if (matched_ == protocol_.header.size())
+          state_ = State::kCollectPayload;
+      } else if (matched_ > 0) {
+        // 헤더 패턴은 자기 겹침이 없으므로 부분 헤더를 버리고 현재 바이트를 다시 검사
+        start = pos;
+        matched_ = 0;
+      } else {
+        start = ++pos;
+      }
+      continue;
+    }
+
+    const std::size_t need = protocol_.frame_bytes - matched_;
+    const std::size_t avail = front.size - pos;
+    if (avail < need) {
+      matched_ += avail;
+      pos = front.size;
+      break;
+    }
+
+    LOADCELL_TRACE_SCOPE("decode");
+    protocol_.decode(data + start, out_status);
+
+    // 프레임 뒤에 수신된 바이트 수만큼 전송 시간을 빼서 마지막 바이트 수신 시각 역산
+    const int64_t behind_ns =
+        static_cast<int64_t>(front.size - (start + protocol_.frame_bytes)) * byte_duration_ns_;
+    out_status.monotonic_ns = newest_monotonic_ns_ ? newest_monotonic_ns_ - behind_ns : 0;
+    out_status.realtime_ns = newest_realtime_ns_ ? newest_realtime_ns_ - behind_ns : 0;
+
+    ring_buffer_->DropFront(start + protocol_.frame_bytes);
+    NoteDiscarded_(start);
+    discarding_ = false;
+    state_ = State::kHuntHeader;
+    matched_ = 0;
+    return ResultCode::kOk;
+  }
+
+  if (start > 0) {
+    ring_buffer_->DropFront(start);
+    NoteDiscarded_(start);
+    if (matched_ == 0)
+      return ResultCode::kNoFrame;
+  }
+
+  return ResultCode::kFrameTooShort;
+}
+
+void FrameParser::Reset() noexcept {
+  ring_buffer_->DropFront(ring_buffer_->Size());
+  state_ = State::kHuntHeader;
+  matched_ = 0;
+}
+
+std::size_t FrameParser::BufferedBytes() const noexcept {
+  return ring_buffer_->Size();
+}
+
+void FrameParser::CollectStats(LoadCellStats &out_stats) const noexcept {
+  out_stats.resync_events = resync_events_.Load();
+  out_stats.bytes_discarded = bytes_discarded_.Load();
+  out_stats.overflow_events = overflow_events_.Load();
+  out_stats.overflow_bytes = overflow_bytes_.Load();
+}
+
+void FrameParser::NoteDiscarded_(std::size_t count) noexcept {
+  if (count == 0)
+    return;
+
+  if (!discarding_) {
+    resync_events_.Add(1);
+    discarding_ = true;
+  }
+  bytes_discarded_.Add(count);
+}
+
+void FrameParser::ApplyScale(const uint8_t *frame, LoadCellStatus &status) noexcept {
+  // weight: 4바이트 big-endian 정수 → raw count (보정은 Calibration에서 적용)
+  LoadCellFrameLayout::Decode(frame, status);
+}
+} // namespace loadcell_comm
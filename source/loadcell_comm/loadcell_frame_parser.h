@@ -0,0 +1,86 @@
+#ifndef LOADCELL_FRAME_PARSER_H_
+#define LOADCELL_FRAME_PARSER_H_
+
+#include "frame_layout.h"
+#include "loadcell_stats.h"
+#include "loadcell_status.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class ByteRingBuffer;
+
+namespace loadcell_comm {
+// 바이트 단위 상태 기계 프레임 파서
+// - kHuntHeader: 헤더(기본 0x55 0xAB 0x01) 탐색 (SIMD FindSyncPattern), 헤더가 아닌 바이트는 즉시 폐기
+// - kCollectPayload: 헤더 이후 프레임 길이(기본 25 bytes)까지 누적 → FrameProtocol::decode
+// - 헤더/길이/디코더는 FrameProtocol로 지정 (frame_layout.h 참고)
+// - 검사 위치를 호출 간 유지하므로 수신 바이트는 한 번만 검사됨 (버퍼 크기에 선형)
+class FrameParser {
+public:
+  // 기본 프로토콜 프레임 길이
+  static constexpr std::size_t kFrameBytes = LoadCellFrameLayout::kFrameBytes;
+
+  // decode 미설정, frame_bytes가 버퍼 용량보다 크거나 헤더보다 짧음,
+  // 헤더 첫 바이트가 헤더 안에서 반복되면 std::invalid_argument
+  explicit FrameParser(std::size_t buffer_bytes,
+                       const FrameProtocol &protocol = kLoadCellFrameProtocol);
+  ~FrameParser();
+
+    FrameParser(const FrameParser &) = delete;
+    FrameParser &operator=(const FrameParser &) = delete;
+
+    // 수신 바이트 누적
+    // 링버퍼 용량 초과로 oldest 데이터가 버려지면 상태 기계를 처음부터 재시작
+    // arrival_*_ns: 이 데이터의 마지막 바이트 수신 시각 (0이면 미기록)
+    // 반환: overflow로 버려진 바이트 수
+    std::size_t Feed(const uint8_t *data, std::size_t size,
+                     int64_t arrival_monotonic_ns = 0,
+                     int64_t arrival_realtime_ns = 0);
+
+    // 1바이트 전송 시간(ns): 프레임 시각 역산용 (0이면 read 반환 시각을 그대로 사용)
+    void SetByteDurationNs(int64_t byte_duration_ns) noexcept;
+
+    // 다음 프레임 1개 디코딩
+    // kOk: 프레임 디코딩
+    // kFrameTooShort: 부분 프레임 수신 중 또는 검사할 데이터 없음
+    // kNoFrame: 헤더가 아닌 데이터를 폐기했고 남은 데이터에 프레임 시작이 없음
+    ResultCode Next(LoadCellStatus &out_status) noexcept;
+
+    // 누적 데이터와 상태 기계 초기화
+    void Reset() noexcept;
+
+    std::size_t BufferedBytes() const noexcept;
+
+    // 파서 단계 통계(resync/discard/overflow)를 out_stats에 기록 (임의 스레드에서 호출 가능)
+    void CollectStats(LoadCellStats &out_stats) const noexcept;
+
+    // 기본 프로토콜 25 bytes 프레임 → LoadCellStatus
+    static void ApplyScale(const uint8_t *frame, LoadCellStatus &status) noexcept;
+
+private:
+    enum class State { kHuntHeader, kCollectPayload };
+
+    void NoteDiscarded_(std::size_t count) noexcept;
+
+    std::unique_ptr<ByteRingBuffer> ring_buffer_;
+    FrameProtocol protocol_;
+    State state_ = State::kHuntHeader;
+    // 링버퍼 앞쪽에서 현재 후보 프레임으로 이미 검사된 바이트 수
+    std::size_t matched_ = 0;
+    // 링버퍼 최신 바이트의 수신 시각
+    int64_t newest_monotonic_ns_ = 0;
+    int64_t newest_realtime_ns_ = 0;
+    int64_t byte_duration_ns_ = 0;
+
+    // 연속 폐기 구간 진행 중 여부 (resync_events 집계용)
+    bool discarding_ = false;
+
+    StatCounter resync_events_;
+    StatCounter bytes_discarded_;
+    StatCounter overflow_events_;
+    StatCounter overflow_bytes_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_FRAME_PARSER_H_
@@ -0,0 +1,206 @@
+#include "loadcell_hub.h"
+#include "SerialConfig.h"
+#include "loadcell_485.h"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace {
+constexpr int kMaxEvents = 16;
+constexpr std::size_t kBatchFrames = 32;
+
+std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+}  // namespace
+
+namespace loadcell_comm {
+struct LoadCellHub::Device {
+  int device_id = 0;
+  std::unique_ptr<LoadCell485> loadcell;
+};
+
+LoadCellHub::LoadCellHub() {
+  epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
+  if (epoll_fd_ < 0)
+    throw std::runtime_error(SysErr("epoll_create1"));
+
+  wake_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+  if (wake_fd_ < 0) {
+    const std::string error = SysErr("eventfd");
+    ::close(epoll_fd_);
+    throw std::runtime_error(error);
+  }
+
+  // data.ptr == nullptr 은 wake 이벤트
+  epoll_event ev{};
+  ev.events = EPOLLIN;
+  ev.data.ptr = nullptr;
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &ev) != 0) {
+    const std::string error = SysErr("epoll_ctl(eventfd)");
+    ::close(wake_fd_);
+    ::close(epoll_fd_);
+    throw std::runtime_error(error);
+  }
+}
+
+LoadCellHub::~LoadCellHub() {
+  devices_.clear();
+  ::close(wake_fd_);
+  ::close(epoll_fd_);
+}
+
+void LoadCellHub::SetFrameCallback(FrameCallback callback) {
+  frame_callback_ = std::move(callback);
+}
+
+void LoadCellHub::SetErrorCallback(ErrorCallback callback) {
+  error_callback_ = std::move(callback);
+}
+
+bool LoadCellHub::AddDevice(int device_id, const SerialConfig &cfg) {
+  for (const auto &device : devices_) {
+    if (device->device_id == device_id) {
+      last_error_ = "AddDevice(): duplicate device id " + std::to_string(device_id);
+      return false;
+    }
+  }
+
+  SerialConfig hub_cfg = cfg;
+  hub_cfg.non_blocking = true;
+  hub_cfg.vmin = 0;
+  hub_cfg.vtime_ds = 0;
+
+  auto device = std::make_unique<Device>();
+  device->device_id = device_id;
+  device->loadcell = std::make_unique<LoadCell485>();
+  if (!device->loadcell->Open(hub_cfg)) {
+    last_error_ = device->loadcell->GetLastError();
+    return false;
+  }
+
+  epoll_event ev{};
+  ev.events = EPOLLIN;
+  ev.data.ptr = device.get();
+  if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, device->loadcell->NativeHandle(), &ev) != 0) {
+    last_error_ = SysErr("epoll_ctl(add)");
+    return false;
+  }
+
+  devices_.push_back(std::move(device));
+  return true;
+}
+
+bool LoadCellHub::RemoveDevice(int device_id) {
+  auto it = std::find_if(devices_.begin(), devices_.end(),
+                         [device_id](const std::unique_ptr<Device> &device) {
+                           return device->device_id == device_id;
+                         });
+  if (it == devices_.end()) {
+    last_error_ = "RemoveDevice(): unknown device id " + std::to_string(device_id);
+    return false;
+  }
+
+  if ((*it)->loadcell->IsOpen())
+    ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, (*it)->loadcell->NativeHandle(), nullptr);
+
+  devices_.erase(it);
+  return true;
+}
+
+std::size_t LoadCellHub::DeviceCount() const noexcept { return devices_.size(); }
+
+bool LoadCellHub::GetStats(int device_id, LoadCellStats &out_stats) const noexcept {
+  for (const auto &device : devices_) {
+    if (device->device_id == device_id) {
+      out_stats = device->loadcell->GetStats();
+      return true;
+    }
+  }
+  return false;
+}
+
+int LoadCellHub::PollOnce(int timeout_ms) {
+  std::array<epoll_event, kMaxEvents> events{};
+  const int ready = ::epoll_wait(epoll_fd_, events.data(), kMaxEvents, timeout_ms);
+  if (ready < 0) {
+    if (errno == EINTR)
+      return 0;
+    last_error_ = SysErr("epoll_wait");
+    return -1;
+  }
+
+  int frames = 0;
+  for (int i = 0; i < ready; ++i) {
+    if (events[i].data.ptr == nullptr) {
+      uint64_t value = 0;
+      (void)::read(wake_fd_, &value, sizeof(value));
+      continue;
+    }
+
+    Device &device = *static_cast<Device *>(events[i].data.ptr);
+    if (!device.loadcell->IsOpen())
+      continue;
+
+    DrainDevice_(device, frames);
+
+    // 남은 데이터를 처리한 뒤 hang-up/오류 장치는 제거 (level-triggered 재통지 방지)
+    if (device.loadcell->IsOpen() && (events[i].events & (EPOLLHUP | EPOLLERR)))
+      DropDevice_(device, "epoll: device hang-up or error");
+  }
+
+  return frames;
+}
+
+bool LoadCellHub::Run() {
+  // 진입 시 초기화하지 않음: Run() 시작 전에 호출된 Stop()도 유효, 요청은 종료 시 소비
+  while (!stop_requested_.exchange(false, std::memory_order_relaxed)) {
+    if (PollOnce(-1) < 0)
+      return false;
+  }
+  return true;
+}
+
+void LoadCellHub::Stop() noexcept {
+  stop_requested_.store(true, std::memory_order_relaxed);
+  const uint64_t one = 1;
+  (void)::write(wake_fd_, &one, sizeof(one));
+}
+
+const std::string &LoadCellHub::GetLastError() const noexcept {
+  return last_error_;
+}
+
+void LoadCellHub::DrainDevice_(Device &device, int &frames) {
+  std::array<LoadCellStatus, kBatchFrames> batch{};
+  std::size_t count = 0;
+
+  // 배치가 가득 찼으면 링버퍼에 프레임이 더 남아 있을 수 있음
+  do {
+    const ResultCode rc = device.loadcell->RecvBatch(batch.data(), batch.size(), count);
+    if (rc == ResultCode::kIoReadFail) {
+      DropDevice_(device, device.loadcell->GetLastError());
+      return;
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+      if (frame_callback_)
+        frame_callback_(device.device_id, batch[i]);
+    }
+    frames += static_cast<int>(count);
+  } while (count == batch.size());
+}
+
+void LoadCellHub::DropDevice_(Device &device, const std::string &error) {
+  ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, device.loadcell->NativeHandle(), nullptr);
+  device.loadcell->Close();
+
+  if (error_callback_)
+    error_callback_(device.device_id, error);
+}
+} // namespace loadcell_comm
@@ -0,0 +1,73 @@
+#ifndef LOADCELL_HUB_H_
+#define LOADCELL_HUB_H_
+
+#include "loadcell_stats.h"
+#include "loadcell_status.h"
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct SerialConfig;
+
+namespace loadcell_comm {
+class LoadCell485;
+
+// 단일 스레드에서 epoll로 여러 RS-485 포트를 동시에 수신한다.
+// - 각 포트는 non-blocking 모드로 열리며 포트별 링버퍼/파서를 가짐
+// - 디코딩된 프레임은 device_id와 함께 콜백으로 전달
+// - 콜백 내에서 AddDevice/RemoveDevice 호출 금지
+class LoadCellHub {
+public:
+  using FrameCallback = std::function<void(int device_id, const LoadCellStatus &status)>;
+  using ErrorCallback = std::function<void(int device_id, const std::string &error)>;
+
+  // epoll/eventfd 생성 실패 시 std::runtime_error
+  LoadCellHub();
+  ~LoadCellHub();
+
+    LoadCellHub(const LoadCellHub &) = delete;
+    LoadCellHub &operator=(const LoadCellHub &) = delete;
+
+    void SetFrameCallback(FrameCallback callback);
+    // read 오류/장치 분리 시 호출되며 해당 장치는 epoll에서 제거되고 닫힘
+    void SetErrorCallback(ErrorCallback callback);
+
+    // cfg.non_blocking은 true로, vmin/vtime_ds는 0으로 보정됨
+    bool AddDevice(int device_id, const SerialConfig &cfg);
+    bool RemoveDevice(int device_id);
+    std::size_t DeviceCount() const noexcept;
+    // 장치별 수신 통계 (등록되지 않은 device_id면 false)
+    bool GetStats(int device_id, LoadCellStats &out_stats) const noexcept;
+
+    // 이벤트 1회 처리 (timeout_ms: -1 무한 대기, 0 즉시 반환)
+    // 반환: 전달한 프레임 수, epoll 오류 시 -1
+    int PollOnce(int timeout_ms);
+    // Stop() 호출 전까지 PollOnce 반복 (epoll 오류 시 false)
+    // Run() 시작 전에 호출된 Stop()도 적용되어 즉시 반환
+    bool Run();
+    // 임의 스레드에서 호출 가능, Run()을 깨워 종료시킴
+    void Stop() noexcept;
+
+    const std::string &GetLastError() const noexcept;
+
+private:
+    struct Device;
+
+    void DrainDevice_(Device &device, int &frames);
+    void DropDevice_(Device &device, const std::string &error);
+
+private:
+    int epoll_fd_ = -1;
+    int wake_fd_ = -1;
+    std::atomic<bool> stop_requested_{false};
+
+    std::vector<std::unique_ptr<Device>> devices_;
+    FrameCallback frame_callback_;
+    ErrorCallback error_callback_;
+    std::string last_error_;
+};
+} // namespace loadcell_comm
+
+#endif // LOADCELL_HUB_H_
@@ -0,0 +1,398 @@
+#include "loadcell_logger.h"
+#include "SpscQueue.h"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+constexpr char kSegmentMagic[8] = {'L', 'C', 'L', 'O', 'G', 'S', 'G', '\0'};
+constexpr uint32_t kSegmentVersion = 1;
+constexpr char kSegmentSuffix[] = ".lclog";
+constexpr std::size_t kIndexDigits = 6;
+constexpr std::size_t kWriteBatch = 256;
+
+std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+
+std::string SegmentPath(const std::string &directory, const std::string &prefix,
+                        uint64_t index) {
+  char name[32];
+  std::snprintf(name, sizeof(name), "_%06llu",
+                static_cast<unsigned long long>(index));
+  return directory + "/" + prefix + name + kSegmentSuffix;
+}
+
+// "<prefix>_NNNNNN.lclog" → index
+bool ParseSegmentName(const std::string &name, const std::string &prefix,
+                      uint64_t &out_index) {
+  const std::size_t suffix_len = sizeof(kSegmentSuffix) - 1;
+  if (name.size() != prefix.size() + 1 + kIndexDigits + suffix_len)
+    return false;
+  if (name.compare(0, prefix.size(), prefix) != 0 || name[prefix.size()] != '_')
+    return false;
+  if (name.compare(name.size() - suffix_len, suffix_len, kSegmentSuffix) != 0)
+    return false;
+
+  uint64_t index = 0;
+  for (std::size_t i = 0; i < kIndexDigits; ++i) {
+    const char c = name[prefix.size() + 1 + i];
+    if (c < '0' || c > '9')
+      return false;
+    index = index * 10 + static_cast<uint64_t>(c - '0');
+  }
+  out_index = index;
+  return true;
+}
+}  // namespace
+
+namespace loadcell_comm {
+LoadCellLogRecord ToLogRecord(const LoadCellStatus &status,
+                              uint64_t sequence) noexcept {
+  LoadCellLogRecord record{};
+  record.sequence = sequence;
+  record.monotonic_ns = status.monotonic_ns;
+  record.realtime_ns = status.realtime_ns;
+  record.gross_weight = status.gross_weight;
+  record.right_weight = status.right_weight;
+  record.left_weight = status.left_weight;
+  record.right_battery_percent = status.right_battery_percent;
+  record.right_charge_status = status.right_charge_status;
+  record.right_online_status = status.right_online_status;
+  record.left_battery_percent = status.left_battery_percent;
+  record.left_charge_status = status.left_charge_status;
+  record.left_online_status = status.left_online_status;
+  record.gross_net_mark = status.gross_net_mark;
+  record.overload_mark = status.overload_mark;
+  record.out_of_tolerance_mark = status.out_of_tolerance_mark;
+  return record;
+}
+
+LoadCellStatus ToStatus(const LoadCellLogRecord &record) noexcept {
+  LoadCellStatus status{};
+  status.gross_weight = record.gross_weight;
+  status.right_weight = record.right_weight;
+  status.left_weight = record.left_weight;
+  status.right_battery_percent = record.right_battery_percent;
+  status.right_charge_status = record.right_charge_status;
+  status.right_online_status = record.right_online_status;
+  status.left_battery_percent = record.left_battery_percent;
+  status.left_charge_status = record.left_charge_status;
+  status.left_online_status = record.left_online_status;
+  status.gross_net_mark = record.gross_net_mark;
+  status.overload_mark = record.overload_mark;
+  status.out_of_tolerance_mark = record.out_of_tolerance_mark;
+  status.monotonic_ns = record.monotonic_ns;
+  status.realtime_ns = record.realtime_ns;
+  return status;
+}
+
+// ---------------- LoadCellLogger ----------------
+LoadCellLogger::LoadCellLogger() = default;
+
+LoadCellLogger::~LoadCellLogger() { Stop(); }
+
+bool LoadCellLogger::Start(const LoadCellLoggerConfig &cfg) {
+  Stop();
+
+  if (cfg.records_per_segment == 0 || cfg.queue_records == 0) {
+    last_error_ = "records_per_segment/queue_records must be > 0";
+    return false;
+  }
+
+  config_ = cfg;
+  last_error_.clear();
+  queue_ = std::make_unique<SpscQueue<LoadCellLogRecord>>(cfg.queue_records);
+  next_sequence_ = 0;
+  dropped_records_.store(0, std::memory_order_relaxed);
+  written_records_.store(0, std::memory_order_relaxed);
+
+  // 기존 세그먼트는 덮어쓰지 않고 다음 index부터 이어서 기록
+  segment_paths_ = LoadCellLogReader::ListSegments(cfg.directory, cfg.prefix);
+  segment_index_ = 0;
+  for (const std::string &path : segment_paths_) {
+    uint64_t index = 0;
+    const std::string name = path.substr(path.find_last_of('/') + 1);
+    if (ParseSegmentName(name, cfg.prefix, index))
+      segment_index_ = std::max(segment_index_, index + 1);
+  }
+
+  // 첫 세그먼트는 호출 스레드에서 열어 경로/권한 오류를 즉시 반환
+  if (!OpenSegment_())
+    return false;
+
+  stop_requested_.store(false, std::memory_order_relaxed);
+  running_.store(true, std::memory_order_release);
+  worker_ = std::thread(&LoadCellLogger::RunLoop_, this);
+  return true;
+}
+
+void LoadCellLogger::Stop() noexcept {
+  stop_requested_.store(true, std::memory_order_relaxed);
+  if (worker_.joinable())
+    worker_.join();
+
+  running_.store(false, std::memory_order_release);
+  CloseSegment_();
+}
+
+bool LoadCellLogger::IsRunning() const noexcept {
+  return running_.load(std::memory_order_acquire);
+}
+
+bool LoadCellLogger::Append(const LoadCellStatus &status) noexcept {
+  if (!queue_ || !running_.load(std::memory_order_relaxed))
+    return false;
+
+  if (!queue_->TryPush(ToLogRecord(status, next_sequence_++))) {
+    dropped_records_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  return true;
+}
+
+uint64_t LoadCellLogger::DroppedRecords() const noexcept {
+  return dropped_records_.load(std::memory_order_relaxed);
+}
+
+uint64_t LoadCellLogger::WrittenRecords() const noexcept {
+  return written_records_.load(std::memory_order_relaxed);
+}
+
+const std::string &LoadCellLogger::GetLastError() const noexcept {
+  return last_error_;
+}
+
+void LoadCellLogger::RunLoop_() noexcept {
+  std::array<LoadCellLogRecord, kWriteBatch> batch{};
+  auto last_flush = std::chrono::steady_clock::now();
+
+  while (true) {
+    // stop 요청 후에도 큐가 빌 때까지 기록
+    const bool stopping = stop_requested_.load(std::memory_order_relaxed);
+    const std::size_t count = queue_->TryPopBulk(batch.data(), batch.size());
+
+    if (count > 0) {
+      WriteRecords_(batch.data(), count);
+      if (segment_ == nullptr)
+        break;  // 세그먼트 생성 실패 (last_error_ 설정됨)
+    } else if (stopping) {
+      break;
+    } else {
+      std::this_thread::sleep_for(config_.idle_sleep);
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    if (segment_ != nullptr && now - last_flush >= config_.flush_interval) {
+      ::msync(segment_, segment_bytes_, MS_ASYNC);
+      last_flush = now;
+    }
+  }
+
+  running_.store(false, std::memory_order_release);
+}
+
+void LoadCellLogger::WriteRecords_(const LoadCellLogRecord *records,
+                                   std::size_t count) noexcept {
+  while (count > 0) {
+    if (segment_records_ == config_.records_per_segment) {
+      CloseSegment_();
+      if (!OpenSegment_())
+        return;
+    }
+
+    const std::size_t room =
+        static_cast<std::size_t>(config_.records_per_segment - segment_records_);
+    const std::size_t n = std::min(room, count);
+    std::memcpy(segment_ + sizeof(LoadCellLogSegmentHeader) +
+                    segment_records_ * sizeof(LoadCellLogRecord),
+                records, n * sizeof(LoadCellLogRecord));
+    segment_records_ += n;
+
+    auto *header = reinterpret_cast<LoadCellLogSegmentHeader *>(segment_);
+    __atomic_store_n(&header->committed_records, segment_records_,
+                     __ATOMIC_RELEASE);
+    written_records_.fetch_add(n, std::memory_order_relaxed);
+
+    records += n;
+    count -= n;
+  }
+}
+
+bool LoadCellLogger::OpenSegment_() noexcept {
+  const std::string path =
+      SegmentPath(config_.directory, config_.prefix, segment_index_);
+  const std::size_t bytes = sizeof(LoadCellLogSegmentHeader) +
+                            config_.records_per_segment * sizeof(LoadCellLogRecord);
+
+  const int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  if (fd < 0) {
+    last_error_ = SysErr("open");
+    return false;
+  }
+
+  // 디스크 공간을 미리 확보 (지원하지 않는 파일시스템이면 sparse 파일)
+  int rc = ::posix_fallocate(fd, 0, static_cast<off_t>(bytes));
+  if (rc == EOPNOTSUPP || rc == EINVAL)
+    rc = ::ftruncate(fd, static_cast<off_t>(bytes)) == 0 ? 0 : errno;
+  if (rc != 0) {
+    errno = rc;
+    last_error_ = SysErr("posix_fallocate");
+    ::close(fd);
+    ::unlink(path.c_str());
+    return false;
+  }
+
+  void *mapped = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    last_error_ = SysErr("mmap");
+    ::unlink(path.c_str());
+    return false;
+  }
+
+  segment_ = static_cast<uint8_t *>(mapped);
+  segment_bytes_ = bytes;
+  segment_records_ = 0;
+
+  LoadCellLogSegmentHeader header{};
+  std::memcpy(header.magic, kSegmentMagic, sizeof(header.magic));
+  header.version = kSegmentVersion;
+  header.record_size = sizeof(LoadCellLogRecord);
+  header.capacity_records = config_.records_per_segment;
+  header.segment_index = segment_index_;
+  header.committed_records = 0;
+  std::memcpy(segment_, &header, sizeof(header));
+
+  ++segment_index_;
+  segment_paths_.push_back(path);
+
+  // 보관 개수 초과 시 가장 오래된 세그먼트 삭제
+  if (config_.max_segments > 0) {
+    while (segment_paths_.size() > config_.max_segments) {
+      ::unlink(segment_paths_.front().c_str());
+      segment_paths_.erase(segment_paths_.begin());
+    }
+  }
+  return true;
+}
+
+void LoadCellLogger::CloseSegment_() noexcept {
+  if (segment_ == nullptr)
+    return;
+
+  ::msync(segment_, segment_bytes_, MS_SYNC);
+  ::munmap(segment_, segment_bytes_);
+  segment_ = nullptr;
+  segment_bytes_ = 0;
+  segment_records_ = 0;
+}
+
+// ---------------- LoadCellLogReader ----------------
+LoadCellLogReader::~LoadCellLogReader() { Close(); }
+
+std::vector<std::string>
+LoadCellLogReader::ListSegments(const std::string &directory,
+                                const std::string &prefix) {
+  std::vector<std::pair<uint64_t, std::string>> found;
+
+  DIR *dir = ::opendir(directory.c_str());
+  if (dir == nullptr)
+    return {};
+
+  while (const dirent *entry = ::readdir(dir)) {
+    uint64_t index = 0;
+    if (ParseSegmentName(entry->d_name, prefix, index))
+      found.emplace_back(index, directory + "/" + entry->d_name);
+  }
+  ::closedir(dir);
+
+  std::sort(found.begin(), found.end());
+  std::vector<std::string> paths;
+  paths.reserve(found.size());
+  for (auto &item : found)
+    paths.push_back(std::move(item.second));
+  return paths;
+}
+
+bool LoadCellLogReader::Open(const std::string &segment_path) {
+  Close();
+
+  const int fd = ::open(segment_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    last_error_ = SysErr("open");
+    return false;
+  }
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    last_error_ = SysErr("fstat");
+    ::close(fd);
+    return false;
+  }
+  const std::size_t bytes = static_cast<std::size_t>(st.st_size);
+  if (bytes < sizeof(LoadCellLogSegmentHeader)) {
+    last_error_ = "segment too short";
+    ::close(fd);
+    return false;
+  }
+
+  void *mapped = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    last_error_ = SysErr("mmap");
+    return false;
+  }
+  mapped_ = static_cast<uint8_t *>(mapped);
+  mapped_bytes_ = bytes;
+
+  const auto *header = reinterpret_cast<const LoadCellLogSegmentHeader *>(mapped_);
+  if (std::memcmp(header->magic, kSegmentMagic, sizeof(kSegmentMagic)) != 0 ||
+      header->version != kSegmentVersion ||
+      header->record_size != sizeof(LoadCellLogRecord)) {
+    last_error_ = "invalid segment header";
+    Close();
+    return false;
+  }
+
+  // 기록 중인 세그먼트도 읽을 수 있도록 committed_records 까지만 노출
+  const uint64_t committed =
+      __atomic_load_n(&header->committed_records, __ATOMIC_ACQUIRE);
+  const std::size_t fit =
+      (bytes - sizeof(LoadCellLogSegmentHeader)) / sizeof(LoadCellLogRecord);
+  records_ = reinterpret_cast<const LoadCellLogRecord *>(
+      mapped_ + sizeof(LoadCellLogSegmentHeader));
+  record_count_ = static_cast<std::size_t>(
+      std::min<uint64_t>(committed, std::min<uint64_t>(fit, header->capacity_records)));
+  segment_index_ = header->segment_index;
+  cursor_ = 0;
+  last_error_.clear();
+  return true;
+}
+
+void LoadCellLogReader::Close() noexcept {
+  if (mapped_ != nullptr)
+    ::munmap(mapped_, mapped_bytes_);
+  mapped_ = nullptr;
+  mapped_bytes_ = 0;
+  records_ = nullptr;
+  record_count_ = 0;
+  cursor_ = 0;
+  segment_index_ = 0;
+}
+
+bool LoadCellLogReader::Next(LoadCellLogRecord &out_record) noexcept {
+  if (cursor_ >= record_count_)
+    return false;
+  out_record = records_[cursor_++];
+  return true;
+}
+} // namespace loadcell_comm
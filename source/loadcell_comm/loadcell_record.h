@@ -0,0 +1,124 @@
+#ifndef LOADCELL_RECORD_H_
+#define LOADCELL_RECORD_H_
+
+#include "loadcell_status.h"
+#include <cstdint>
+
+namespace loadcell_comm {
+// 대용량 보관/큐 전달용 고정 크기 레코드 (24 bytes, LoadCellStatus의 절반 이하)
+// - 무게는 보정 전 원시 count (int32), 상태 9 bytes는 그대로
+// - 수신 시각은 포함하지 않음 (필요하면 호출자가 별도 보관)
+struct LoadCellRecord {
+  int32_t gross_raw = 0;
+  int32_t right_raw = 0;
+  int32_t left_raw = 0;
+
+  uint8_t right_battery_percent = 0;
+  uint8_t right_charge_status = 0;
+  uint8_t right_online_status = 0;
+
+  uint8_t left_battery_percent = 0;
+  uint8_t left_charge_status = 0;
+  uint8_t left_online_status = 0;
+
+  uint8_t gross_net_mark = 0;
+  uint8_t overload_mark = 0;
+  uint8_t out_of_tolerance_mark = 0;
+
+  uint8_t reserved[3] = {0, 0, 0};
+};
+static_assert(sizeof(LoadCellRecord) == 24, "LoadCellRecord layout");
+
+// 채널 보정값: weight = (raw - offset) * gain - tare
+struct ChannelCalibration {
+  double gain = 1.0;
+  double offset = 0.0; // 원시 count 단위 영점
+  double tare = 0.0;   // 보정 후 단위 용기 무게
+};
+
+struct CalibrationConfig {
+  ChannelCalibration gross;
+  ChannelCalibration right;
+  ChannelCalibration left;
+};
+
+// 보정 단계
+// 생성 시 채널별 (scale, bias)로 미리 계산 → 적용은 채널당 곱셈/덧셈 1회 (분기 없음)
+// 기본 생성: 항등 변환 (raw count 그대로)
+class Calibration {
+public:
+  Calibration() = default;
+  explicit Calibration(const CalibrationConfig &cfg) noexcept
+      : gross_(Precompute_(cfg.gross)), right_(Precompute_(cfg.right)),
+        left_(Precompute_(cfg.left)) {}
+
+    // raw count가 들어 있는 무게 필드를 보정값으로 변환
+    void Apply(LoadCellStatus &status) const noexcept {
+      status.gross_weight = status.gross_weight * gross_.scale + gross_.bias;
+      status.right_weight = status.right_weight * right_.scale + right_.bias;
+      status.left_weight = status.left_weight * left_.scale + left_.bias;
+    }
+
+    // 레코드 → 보정된 LoadCellStatus (수신 시각은 0)
+    LoadCellStatus ToStatus(const LoadCellRecord &record) const noexcept {
+      LoadCellStatus status;
+      status.gross_weight = static_cast<double>(record.gross_raw) * gross_.scale + gross_.bias;
+      status.right_weight = static_cast<double>(record.right_raw) * right_.scale + right_.bias;
+      status.left_weight = static_cast<double>(record.left_raw) * left_.scale + left_.bias;
+      status.right_battery_percent = record.right_battery_percent;
+      status.right_charge_status = record.right_charge_status;
+      status.right_online_status = record.right_online_status;
+      status.left_battery_percent = record.left_battery_percent;
+      status.left_charge_status = record.left_charge_status;
+      status.left_online_status = record.left_online_status;
+      status.gross_net_mark = record.gross_net_mark;
+      status.overload_mark = record.overload_mark;
+      status.out_of_tolerance_mark = record.out_of_tolerance_mark;
+      return status;
+    }
+
+    // 채널별 weight = raw * scale + bias 계수 (순서: gross, right, left), 배치 디코더용
+    void Coefficients(double (&scale)[3], double (&bias)[3]) const noexcept {
+      scale[0] = gross_.scale;
+      scale[1] = right_.scale;
+      scale[2] = left_.scale;
+      bias[0] = gross_.bias;
+      bias[1] = right_.bias;
+      bias[2] = left_.bias;
+    }
+
+private:
+    struct Linear {
+      double scale = 1.0;
+      double bias = 0.0;
+    };
+
+    static Linear Precompute_(const ChannelCalibration &ch) noexcept {
+      return Linear{ch.gain, -ch.offset * ch.gain - ch.tare};
+    }
+
+    Linear gross_;
+    Linear right_;
+    Linear left_;
+};
+
+// 보정 전(raw count) LoadCellStatus → 레코드
+inline LoadCellRecord ToRecord(const LoadCellStatus &raw_status) noexcept {
+  LoadCellRecord record;
+  record.gross_raw = static_cast<int32_t>(raw_status.gross_weight);
+  record.right_raw = static_cast<int32_t>(raw_status.right_weight);
+  record.left_raw = static_cast<int32_t>(raw_status.left_weight);
+  record.right_battery_percent = raw_status.right_battery_percent;
+  record.right_charge_status = raw_status.right_charge_status;
+  record.right_online_status = raw_status.right_online_status;
+  record.left_battery_percent = raw_status.left_battery_percent;
+  record.left_charge_status = raw_status.left_charge_status;
+  record.left_online_status = raw_status.left_online_status;
+  record.gross_net_mark = raw_status.gross_net_mark;
+  record.overload_mark = raw_status.overload_mark;
+  record.out_of_tolerance_mark = raw_status.out_of_tolerance_mark;
+  return record;
+}
+} // namespace loadcell_comm
+
+#endif // LOADCELL_RECORD_H_
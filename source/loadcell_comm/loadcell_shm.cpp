@@ -0,0 +1,239 @@
+#include "loadcell_shm.h"
+#include "seqlock_slot.h"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+constexpr char kShmMagic[8] = {'L', 'C', 'S', 'H', 'M', 'S', 'G', '\0'};
+constexpr uint32_t kShmVersion = 1;
+// publisher가 Store 도중 종료된 슬롯에서 reader가 멈추지 않도록 재시도 상한
+constexpr uint32_t kMaxLoadAttempts = 1024;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free &&
+                  std::atomic<uint32_t>::is_always_lock_free,
+              "shared memory seqlock requires address-free (lock-free) atomics");
+
+std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+}  // namespace
+
+namespace loadcell_comm {
+using ShmSlot = SeqLockSlot<LoadCellLogRecord>;
+
+// 공유 메모리 세그먼트 레이아웃 (host byte order, 같은 빌드의 publisher/reader 간 공유)
+// [ShmSegment][ShmSlot x history_frames]
+struct ShmSegment {
+  char magic[8];
+  uint32_t version;
+  uint32_t record_size;
+  uint64_t history_frames;
+  int64_t publisher_pid;
+  std::atomic<uint32_t> ready{0};  // 초기화 완료 후 1 (release)
+  std::atomic<uint32_t> closed{0}; // publisher Close() 후 1
+  alignas(64) ShmSlot latest;
+
+  static std::size_t Bytes(std::size_t history) noexcept {
+    return sizeof(ShmSegment) + history * sizeof(ShmSlot);
+  }
+  ShmSlot *History() noexcept { return reinterpret_cast<ShmSlot *>(this + 1); }
+  const ShmSlot *History() const noexcept {
+    return reinterpret_cast<const ShmSlot *>(this + 1);
+  }
+};
+
+// ---------------- LoadCellShmPublisher ----------------
+
+LoadCellShmPublisher::~LoadCellShmPublisher() { Close(); }
+
+bool LoadCellShmPublisher::Open(const ShmPublisherConfig &cfg) {
+  Close();
+  if (cfg.name.size() < 2 || cfg.name[0] != '/') {
+    last_error_ = "shm name must start with '/': " + cfg.name;
+    return false;
+  }
+
+  // 이전 publisher가 남긴 세그먼트는 버림 (이미 연결된 reader는 기존 매핑 유지)
+  ::shm_unlink(cfg.name.c_str());
+  const int fd = ::shm_open(cfg.name.c_str(), O_CREAT | O_EXCL | O_RDWR, cfg.mode);
+  if (fd < 0) {
+    last_error_ = SysErr("shm_open");
+    return false;
+  }
+
+  const std::size_t bytes = ShmSegment::Bytes(cfg.history_frames);
+  // umask와 무관하게 mode 적용
+  const bool chmod_ok = ::fchmod(fd, cfg.mode) == 0;
+  if (!chmod_ok || ::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+    last_error_ = SysErr(chmod_ok ? "ftruncate" : "fchmod");
+    ::close(fd);
+    ::shm_unlink(cfg.name.c_str());
+    return false;
+  }
+
+  void *mapped = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    last_error_ = SysErr("mmap");
+    ::shm_unlink(cfg.name.c_str());
+    return false;
+  }
+
+  ShmSegment *segment = new (mapped) ShmSegment();
+  for (std::size_t i = 0; i < cfg.history_frames; ++i)
+    new (segment->History() + i) ShmSlot();
+  std::memcpy(segment->magic, kShmMagic, sizeof(kShmMagic));
+  segment->version = kShmVersion;
+  segment->record_size = sizeof(LoadCellLogRecord);
+  segment->history_frames = cfg.history_frames;
+  segment->publisher_pid = ::getpid();
+  segment->ready.store(1, std::memory_order_release);
+
+  segment_ = segment;
+  mapped_bytes_ = bytes;
+  name_ = cfg.name;
+  sequence_ = 0;
+  last_error_.clear();
+  return true;
+}
+
+void LoadCellShmPublisher::Close() noexcept {
+  if (!segment_)
+    return;
+
+  segment_->closed.store(1, std::memory_order_release);
+  ::munmap(segment_, mapped_bytes_);
+  ::shm_unlink(name_.c_str());
+  segment_ = nullptr;
+  mapped_bytes_ = 0;
+}
+
+void LoadCellShmPublisher::Publish(const LoadCellStatus &status) noexcept {
+  if (!segment_)
+    return;
+
+  // sequence는 1부터 (0: 게시 전)
+  const LoadCellLogRecord record = ToLogRecord(status, ++sequence_);
+  // history 먼저 기록 → latest로 보이는 프레임은 항상 history에도 있음
+  if (segment_->history_frames != 0)
+    segment_->History()[(sequence_ - 1) % segment_->history_frames].Store(record);
+  segment_->latest.Store(record);
+}
+
+// ---------------- LoadCellShmReader ----------------
+
+LoadCellShmReader::~LoadCellShmReader() { Close(); }
+
+bool LoadCellShmReader::Open(const std::string &name) {
+  Close();
+  const int fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    last_error_ = SysErr("shm_open");
+    return false;
+  }
+
+  struct stat st{};
+  if (::fstat(fd, &st) != 0) {
+    last_error_ = SysErr("fstat");
+    ::close(fd);
+    return false;
+  }
+  const std::size_t bytes = static_cast<std::size_t>(st.st_size);
+  if (bytes < sizeof(ShmSegment)) {
+    last_error_ = "shm segment not initialized: " + name;
+    ::close(fd);
+    return false;
+  }
+
+  void *mapped = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    last_error_ = SysErr("mmap");
+    return false;
+  }
+
+  const auto *segment = static_cast<const ShmSegment *>(mapped);
+  const char *error = nullptr;
+  if (segment->ready.load(std::memory_order_acquire) != 1)
+    error = "shm segment not initialized: ";
+  else if (std::memcmp(segment->magic, kShmMagic, sizeof(kShmMagic)) != 0 ||
+           segment->version != kShmVersion ||
+           segment->record_size != sizeof(LoadCellLogRecord))
+    error = "shm segment format mismatch: ";
+  else if (bytes < ShmSegment::Bytes(segment->history_frames))
+    error = "shm segment truncated: ";
+
+  if (error) {
+    last_error_ = error + name;
+    ::munmap(mapped, bytes);
+    return false;
+  }
+
+  segment_ = segment;
+  mapped_bytes_ = bytes;
+  last_error_.clear();
+  return true;
+}
+
+void LoadCellShmReader::Close() noexcept {
+  if (!segment_)
+    return;
+
+  ::munmap(const_cast<ShmSegment *>(segment_), mapped_bytes_);
+  segment_ = nullptr;
+  mapped_bytes_ = 0;
+}
+
+bool LoadCellShmReader::Latest(LoadCellLogRecord &out_record) const noexcept {
+  return segment_ && segment_->latest.TryLoad(out_record, kMaxLoadAttempts);
+}
+
+std::size_t LoadCellShmReader::ReadSince(uint64_t after_sequence,
+                                         LoadCellLogRecord *out_records,
+                                         std::size_t capacity) const noexcept {
+  LoadCellLogRecord latest;
+  if (capacity == 0 || !Latest(latest) || latest.sequence <= after_sequence)
+    return 0;
+
+  const uint64_t history = segment_->history_frames;
+  if (history == 0) {
+    out_records[0] = latest;
+    return 1;
+  }
+
+  const uint64_t last = latest.sequence;
+  const uint64_t window = std::min<uint64_t>(history, capacity);
+  const uint64_t first = std::max<uint64_t>(after_sequence + 1,
+                                            last >= window ? last - window + 1 : 1);
+  std::size_t count = 0;
+  for (uint64_t sequence = first; sequence <= last; ++sequence) {
+    LoadCellLogRecord &record = out_records[count];
+    const ShmSlot &slot = segment_->History()[(sequence - 1) % history];
+    // 읽는 사이 덮어쓴 슬롯은 sequence가 달라짐 → 건너뜀
+    if (slot.TryLoad(record, kMaxLoadAttempts) && record.sequence == sequence)
+      ++count;
+  }
+  return count;
+}
+
+uint64_t LoadCellShmReader::Sequence() const noexcept {
+  LoadCellLogRecord latest;
+  return Latest(latest) ? latest.sequence : 0;
+}
+
+std::size_t LoadCellShmReader::HistoryFrames() const noexcept {
+  return segment_ ? static_cast<std::size_t>(segment_->history_frames) : 0;
+}
+
+bool LoadCellShmReader::IsClosed() const noexcept {
+  return !segment_ || segment_->closed.load(std::memory_order_acquire) != 0;
+}
+
+} // namespace loadcell_comm
@@ -20,13 +20,20 @@ struct LoadCellStatus {
   uint8_t gross_net_mark = 0;        // 0: gross, 1: net
   uint8_t overload_mark = 0;         // 0: not overloaded, 1: overload
   uint8_t out_of_tolerance_mark = 0; // 0: ok, 1: left, 2: right
+
+  // 프레임 마지막 바이트 수신 시각 추정치 (read 반환 시각 - 이후 바이트 전송 시간)
+  int64_t monotonic_ns = 0; // CLOCK_MONOTONIC
+  int64_t realtime_ns = 0;  // CLOCK_REALTIME (SerialConfig::capture_realtime, 아니면 0)
 };
 
 enum class ResultCode {
   kOk = 0,
   kFrameTooShort = 1,
+  kNeedMoreData = kFrameTooShort, // 오류 아님: 부분 프레임 수신 중이거나 새 데이터 없음
   kNoFrame = 2,
-  kIoReadFail = 3
+  kIoReadFail = 3,
+  kTimeout = 4,
+  kInvalidArgument = 5 // 호출 인자/설정 오류 (예: LoadCellBus 미등록 주소, 요청 인코더 미설정)
 };
 } // namespace loadcell_comm
 
@@ -0,0 +1,310 @@
+#include "loadcell_supervisor.h"
+#include "loadcell_485.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace {
+// 디렉터리 감시 이벤트: 노드 생성/삭제/이름 변경, udev 권한 설정, 디렉터리 자체 삭제
+constexpr uint32_t kWatchEvents = IN_CREATE | IN_DELETE | IN_ATTRIB | IN_MOVED_TO |
+                                  IN_MOVED_FROM | IN_DELETE_SELF | IN_MOVE_SELF;
+constexpr std::size_t kEventBufferBytes = 4096;
+
+int64_t MonotonicNs_() noexcept {
+  timespec ts{};
+  ::clock_gettime(CLOCK_MONOTONIC, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+
+bool IsDirectory(const std::string &path) {
+  struct stat st{};
+  return ::stat(path.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+}
+
+bool NodeExists(const std::string &path) {
+  struct stat st{};
+  return ::stat(path.c_str(), &st) == 0;
+}
+
+std::string ParentDir(const std::string &path) {
+  const std::size_t slash = path.find_last_of('/');
+  if (slash == std::string::npos)
+    return ".";
+  if (slash == 0)
+    return "/";
+  return path.substr(0, slash);
+}
+
+std::string BaseName(const std::string &path) {
+  const std::size_t slash = path.find_last_of('/');
+  return slash == std::string::npos ? path : path.substr(slash + 1);
+}
+}  // namespace
+
+namespace loadcell_comm {
+LoadCellSupervisor::LoadCellSupervisor(LoadCell485 &loadcell) : loadcell_(loadcell) {}
+
+LoadCellSupervisor::~LoadCellSupervisor() { Stop(); }
+
+void LoadCellSupervisor::SetStateCallback(StateCallback callback) {
+  callback_ = std::move(callback);
+}
+
+bool LoadCellSupervisor::Start(const SerialConfig &cfg,
+                               std::chrono::milliseconds retry_interval) {
+  Stop();
+
+  config_ = cfg;
+  config_.non_blocking = true;
+  retry_interval_ = retry_interval;
+
+  inotify_fd_ = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (inotify_fd_ < 0) {
+    last_error_ = SysErr("inotify_init1");
+    return false;
+  }
+
+  device_dir_ = ParentDir(config_.device);
+  device_name_ = BaseName(config_.device);
+  state_ = ConnectionState::kDisconnected;
+  ever_connected_ = false;
+  node_present_retry_ = false;
+  reconnects_ = 0;
+  disconnected_ns_ = MonotonicNs_();
+  started_ = true;
+
+  RefreshWatch_();
+  TryConnect_();
+  return true;
+}
+
+void LoadCellSupervisor::Stop() noexcept {
+  if (!started_)
+    return;
+
+  loadcell_.Close();
+  ::close(inotify_fd_); // watch도 함께 해제됨
+  inotify_fd_ = -1;
+  watch_fd_ = -1;
+  watched_dir_.clear();
+  state_ = ConnectionState::kDisconnected;
+  started_ = false;
+}
+
+ResultCode LoadCellSupervisor::RecvFor(std::chrono::microseconds timeout,
+                                       LoadCellStatus &out_status) {
+  return RecvUntil(std::chrono::steady_clock::now() + timeout, out_status);
+}
+
+ResultCode LoadCellSupervisor::RecvUntil(std::chrono::steady_clock::time_point deadline,
+                                         LoadCellStatus &out_status) {
+  if (!started_) {
+    last_error_ = "RecvUntil(): supervisor is not started";
+    return ResultCode::kIoReadFail;
+  }
+
+  bool hangup = false;
+  for (;;) {
+    if (state_ == ConnectionState::kConnected) {
+      // 지난 기한 → 버퍼 파싱 + non-blocking read 1회만 수행
+      const ResultCode rc = loadcell_.RecvUntil(std::chrono::steady_clock::time_point{}, out_status);
+      if (rc == ResultCode::kOk)
+        return rc;
+      if (rc == ResultCode::kIoReadFail)
+        Disconnect_(loadcell_.GetLastError());
+      else if (hangup) // hang-up 후 read가 EOF(0)만 반환하는 드라이버
+        Disconnect_("device hang-up");
+    }
+    hangup = false;
+
+    auto now = std::chrono::steady_clock::now();
+    const bool retry_enabled = RetryArmed_();
+    if (state_ == ConnectionState::kDisconnected && retry_enabled && now >= next_retry_ &&
+        TryConnect_())
+      continue;
+
+    if (now >= deadline)
+      return ResultCode::kTimeout;
+
+    auto wake = deadline;
+    if (state_ == ConnectionState::kDisconnected && retry_enabled)
+      wake = std::min(wake, next_retry_);
+    const auto remain_ns = std::max<int64_t>(
+        0, std::chrono::duration_cast<std::chrono::nanoseconds>(wake - now).count());
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(remain_ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(remain_ns % 1000000000LL);
+
+    pollfd fds[2]{};
+    fds[0].fd = inotify_fd_;
+    fds[0].events = POLLIN;
+    nfds_t nfds = 1;
+    if (state_ == ConnectionState::kConnected) {
+      fds[1].fd = loadcell_.NativeHandle();
+      fds[1].events = POLLIN;
+      nfds = 2;
+    }
+
+    const int ready = ::ppoll(fds, nfds, &ts, nullptr);
+    if (ready < 0) {
+      if (errno == EINTR)
+        continue;
+      last_error_ = SysErr("ppoll");
+      return ResultCode::kIoReadFail;
+    }
+
+    // 포트 오류는 재연결 처리 전에 판단 (재연결 후 fd 번호가 같을 수 있음)
+    if (nfds == 2 && (fds[1].revents & (POLLHUP | POLLERR | POLLNVAL)))
+      hangup = true;
+    if (fds[0].revents & POLLIN) {
+      if (hangup) {
+        Disconnect_("device hang-up");
+        hangup = false;
+      }
+      HandleWatchEvents_();
+    }
+  }
+}
+
+bool LoadCellSupervisor::TryConnect_() {
+  next_retry_ = std::chrono::steady_clock::now() + RetryInterval_();
+  if (!loadcell_.Open(config_)) {
+    last_error_ = loadcell_.GetLastError();
+    return false;
+  }
+
+  // 커널 입력 큐와 링버퍼에 남은 이전 연결의 바이트 제거
+  ::tcflush(loadcell_.NativeHandle(), TCIFLUSH);
+  loadcell_.ResetBuffer();
+
+  ConnectionEvent event;
+  event.state = ConnectionState::kConnected;
+  event.monotonic_ns = MonotonicNs_();
+  event.detail = config_.device;
+  if (ever_connected_) {
+    event.outage_ns = event.monotonic_ns - disconnected_ns_;
+    ++reconnects_;
+  }
+  ever_connected_ = true;
+  node_present_retry_ = false;
+  connected_since_ = std::chrono::steady_clock::now();
+  state_ = ConnectionState::kConnected;
+  Notify_(std::move(event));
+  return true;
+}
+
+bool LoadCellSupervisor::RetryArmed_() const noexcept {
+  return retry_interval_.count() > 0 || node_present_retry_;
+}
+
+std::chrono::milliseconds LoadCellSupervisor::RetryInterval_() const noexcept {
+  return retry_interval_.count() > 0 ? retry_interval_ : kMinRetryInterval;
+}
+
+void LoadCellSupervisor::Disconnect_(std::string detail) {
+  loadcell_.Close();
+  state_ = ConnectionState::kDisconnected;
+  disconnected_ns_ = MonotonicNs_();
+  const auto now = std::chrono::steady_clock::now();
+  // 노드가 남아 있으면(일시적 read 오류 등) inotify 이벤트가 오지 않으므로 타이머로 재연결
+  // 직전 연결이 kMinRetryInterval 이상 유지되었으면 즉시 1회 재Open, 아니면 간격을 두고 재시도
+  node_present_retry_ = NodeExists(config_.device);
+  if (node_present_retry_ && now - connected_since_ >= kMinRetryInterval)
+    next_retry_ = now;
+  else
+    next_retry_ = now + RetryInterval_();
+  last_error_ = detail;
+  RefreshWatch_();
+
+  ConnectionEvent event;
+  event.state = ConnectionState::kDisconnected;
+  event.monotonic_ns = disconnected_ns_;
+  event.detail = std::move(detail);
+  Notify_(std::move(event));
+}
+
+void LoadCellSupervisor::HandleWatchEvents_() {
+  alignas(inotify_event) char buffer[kEventBufferBytes];
+  bool appeared = false;
+  bool removed = false;
+  bool refresh = false;
+
+  for (;;) {
+    const ssize_t n = ::read(inotify_fd_, buffer, sizeof(buffer));
+    if (n <= 0)
+      break;
+
+    for (ssize_t offset = 0; offset < n;) {
+      const auto *event = reinterpret_cast<const inotify_event *>(buffer + offset);
+      offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+      if (event->mask & (IN_DELETE_SELF | IN_MOVE_SELF | IN_IGNORED | IN_Q_OVERFLOW)) {
+        // 감시 중인 디렉터리가 삭제/이동됨 → 같은 경로로 다시 생겨도 새 watch 필요
+        if (event->wd == watch_fd_ && !(event->mask & IN_Q_OVERFLOW)) {
+          ::inotify_rm_watch(inotify_fd_, watch_fd_);
+          watch_fd_ = -1;
+        }
+        refresh = true;
+      } else if (watched_dir_ != device_dir_) {
+        // 상위 디렉터리 감시 중: 하위 경로가 생겼는지 다시 확인
+        refresh = true;
+      } else if (event->len > 0 && device_name_ == event->name) {
+        if (event->mask & (IN_DELETE | IN_MOVED_FROM))
+          removed = true;
+        else
+          appeared = true; // IN_CREATE, IN_MOVED_TO, IN_ATTRIB (udev 권한 설정)
+      }
+    }
+  }
+
+  if (refresh) {
+    RefreshWatch_();
+    appeared = true;
+  }
+
+  if (removed) {
+    // 노드가 없어졌으므로 재연결은 다시 생성 이벤트로
+    if (state_ == ConnectionState::kConnected)
+      Disconnect_("device node removed: " + config_.device);
+    node_present_retry_ = false;
+  }
+  if (appeared && state_ == ConnectionState::kDisconnected)
+    TryConnect_();
+}
+
+void LoadCellSupervisor::RefreshWatch_() {
+  // 장치 디렉터리, 없으면 존재하는 가장 가까운 상위 디렉터리
+  std::string dir = device_dir_;
+  while (!IsDirectory(dir) && dir != "/" && dir != ".")
+    dir = ParentDir(dir);
+
+  if (watch_fd_ >= 0 && dir == watched_dir_)
+    return;
+
+  if (watch_fd_ >= 0)
+    ::inotify_rm_watch(inotify_fd_, watch_fd_);
+  watch_fd_ = ::inotify_add_watch(inotify_fd_, dir.c_str(), kWatchEvents);
+  if (watch_fd_ < 0) {
+    last_error_ = SysErr("inotify_add_watch");
+    watched_dir_.clear();
+  } else {
+    watched_dir_ = dir;
+  }
+}
+
+void LoadCellSupervisor::Notify_(ConnectionEvent event) {
+  if (callback_)
+    callback_(event);
+}
+
+} // namespace loadcell_comm
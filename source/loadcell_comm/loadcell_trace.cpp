@@ -0,0 +1,199 @@
+#include "loadcell_trace.h"
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+static_assert((loadcell_comm::kTraceEventsPerThread & (loadcell_comm::kTraceEventsPerThread - 1)) == 0,
+              "kTraceEventsPerThread must be a power of two");
+
+// 고정 크기 이벤트 (32 bytes), 덤프 스레드와 동시 접근하므로 relaxed atomic 필드
+struct TraceEvent {
+  std::atomic<const char *> name{nullptr};
+  std::atomic<int64_t> begin_ns{0};
+  std::atomic<int64_t> dur_ns{0};
+  std::atomic<uint64_t> arg{0};
+};
+
+struct TraceEventCopy {
+  const char *name;
+  int64_t begin_ns;
+  int64_t dur_ns;
+  uint64_t arg;
+};
+
+// 스레드별 링 (writer: 소유 스레드 1개, reader: 덤프 호출 스레드)
+// 스레드 종료 후에도 덤프할 수 있도록 registry가 프로세스 종료까지 소유
+struct TraceRing {
+  std::unique_ptr<TraceEvent[]> events{new TraceEvent[loadcell_comm::kTraceEventsPerThread]};
+  std::atomic<uint64_t> head{0};  // 지금까지 기록한 이벤트 수
+  std::atomic<uint64_t> base{0};  // ClearTrace() 시점의 head
+  long tid = 0;
+  std::string thread_name;        // registry mutex로 보호
+};
+
+struct TraceRegistry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<TraceRing>> rings;
+};
+
+TraceRegistry &Registry() {
+  static TraceRegistry registry;
+  return registry;
+}
+
+thread_local TraceRing *tls_ring = nullptr;
+
+TraceRing *ThreadRing() noexcept {
+  if (tls_ring)
+    return tls_ring;
+
+  try {
+    auto ring = std::make_unique<TraceRing>();
+    ring->tid = ::syscall(SYS_gettid);
+    TraceRegistry &registry = Registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.rings.push_back(std::move(ring));
+    tls_ring = registry.rings.back().get();
+  } catch (...) {
+    return nullptr;
+  }
+  return tls_ring;
+}
+
+void AppendEscaped(std::string &out, const char *text) {
+  for (const char *p = text; *p; ++p) {
+    const char c = *p;
+    if (c == '"' || c == '\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c) >= 0x20) {
+      out += c;
+    }
+  }
+}
+}  // namespace
+
+namespace loadcell_comm {
+namespace trace_detail {
+void Record(const char *name, int64_t begin_ns, int64_t end_ns, uint64_t arg) noexcept {
+  TraceRing *ring = ThreadRing();
+  if (!ring)
+    return;
+
+  const uint64_t head = ring->head.load(std::memory_order_relaxed);
+  // seqlock writer와 같은 순서: 이전 head 공개 → 슬롯 덮어쓰기
+  // (덤프가 새 필드 값을 보면 head_after >= head가 보장되어 이 슬롯은 valid_from 밖)
+  std::atomic_thread_fence(std::memory_order_release);
+  TraceEvent &event = ring->events[head & (kTraceEventsPerThread - 1)];
+  event.name.store(name, std::memory_order_relaxed);
+  event.begin_ns.store(begin_ns, std::memory_order_relaxed);
+  event.dur_ns.store(end_ns - begin_ns, std::memory_order_relaxed);
+  event.arg.store(arg, std::memory_order_relaxed);
+  ring->head.store(head + 1, std::memory_order_release);
+}
+} // namespace trace_detail
+
+std::string ChromeTraceJson() {
+  const long pid = static_cast<long>(::getpid());
+  std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+  bool first = true;
+  char line[256];
+  std::vector<TraceEventCopy> copies;
+
+  TraceRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto &ring : registry.rings) {
+    if (!ring->thread_name.empty()) {
+      std::snprintf(line, sizeof(line),
+                    "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%ld,\"tid\":%ld,"
+                    "\"args\":{\"name\":\"",
+                    first ? "" : ",", pid, ring->tid);
+      json += line;
+      AppendEscaped(json, ring->thread_name.c_str());
+      json += "\"}}";
+      first = false;
+    }
+
+    // [begin, head) 복사 후 그 사이 writer가 덮어쓴 구간은 제외
+    const uint64_t head = ring->head.load(std::memory_order_acquire);
+    const uint64_t base = ring->base.load(std::memory_order_relaxed);
+    uint64_t begin = head > kTraceEventsPerThread ? head - kTraceEventsPerThread : 0;
+    if (begin < base)
+      begin = base;
+
+    copies.clear();
+    for (uint64_t i = begin; i < head; ++i) {
+      const TraceEvent &event = ring->events[i & (kTraceEventsPerThread - 1)];
+      copies.push_back(TraceEventCopy{event.name.load(std::memory_order_relaxed),
+                                      event.begin_ns.load(std::memory_order_relaxed),
+                                      event.dur_ns.load(std::memory_order_relaxed),
+                                      event.arg.load(std::memory_order_relaxed)});
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t head_after = ring->head.load(std::memory_order_relaxed);
+    // writer가 head_after 슬롯(= head_after - N과 같은 슬롯)을 쓰는 중일 수 있으므로 그 슬롯도 제외
+    const uint64_t valid_from =
+        head_after >= kTraceEventsPerThread ? head_after - kTraceEventsPerThread + 1 : 0;
+
+    for (std::size_t i = 0; i < copies.size(); ++i) {
+      const TraceEventCopy &event = copies[i];
+      if (begin + i < valid_from || event.name == nullptr)
+        continue;
+
+      // ts/dur 단위: us (소수점 이하 ns)
+      std::snprintf(line, sizeof(line),
+                    "%s{\"name\":\"", first ? "" : ",");
+      json += line;
+      AppendEscaped(json, event.name);
+      std::snprintf(line, sizeof(line),
+                    "\",\"cat\":\"loadcell\",\"ph\":\"X\",\"ts\":%lld.%03lld,\"dur\":%lld.%03lld,"
+                    "\"pid\":%ld,\"tid\":%ld,\"args\":{\"arg\":%llu}}",
+                    static_cast<long long>(event.begin_ns / 1000),
+                    static_cast<long long>(event.begin_ns % 1000),
+                    static_cast<long long>(event.dur_ns / 1000),
+                    static_cast<long long>(event.dur_ns % 1000), pid, ring->tid,
+                    static_cast<unsigned long long>(event.arg));
+      json += line;
+      first = false;
+    }
+  }
+
+  json += "]}\n";
+  return json;
+}
+
+bool WriteChromeTrace(const std::string &path) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file)
+    return false;
+
+  file << ChromeTraceJson();
+  return static_cast<bool>(file.flush());
+}
+
+void ClearTrace() {
+  TraceRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto &ring : registry.rings)
+    ring->base.store(ring->head.load(std::memory_order_acquire), std::memory_order_relaxed);
+}
+
+void PrepareTraceThread() noexcept { ThreadRing(); }
+
+void SetTraceThreadName(const char *name) {
+  TraceRing *ring = ThreadRing();
+  if (!ring || !name)
+    return;
+
+  TraceRegistry &registry = Registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  ring->thread_name = name;
+}
+
+} // namespace loadcell_comm
@@ -0,0 +1,89 @@
+#ifndef SEQLOCK_SLOT_H_
+#define SEQLOCK_SLOT_H_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace loadcell_comm {
+// 단일 writer / 다중 reader 최신값 슬롯 (seqlock)
+// - writer는 대기하지 않음, reader는 lock 없이 재시도
+// - 데이터는 relaxed atomic word 단위로 복사하여 data race 없음
+template <typename T>
+class SeqLockSlot {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SeqLockSlot requires a trivially copyable type");
+
+public:
+  SeqLockSlot() = default;
+  SeqLockSlot(const SeqLockSlot &) = delete;
+  SeqLockSlot &operator=(const SeqLockSlot &) = delete;
+
+  // writer 스레드 전용
+  void Store(const T &value) noexcept {
+    std::array<uint64_t, kWords> words{};
+    std::memcpy(words.data(), &value, sizeof(T));
+
+    const uint64_t seq = seq_.load(std::memory_order_relaxed);
+    seq_.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t i = 0; i < kWords; ++i)
+      words_[i].store(words[i], std::memory_order_relaxed);
+
+    seq_.store(seq + 2, std::memory_order_release);
+  }
+
+  // 아직 한 번도 Store되지 않았으면 false
+  // out_sequence: 지금까지 Store된 횟수 (선택)
+  bool Load(T &out, uint64_t *out_sequence = nullptr) const noexcept {
+    return LoadImpl_(out, out_sequence, 0);
+  }
+
+  // Load와 동일하나 일관된 값을 max_attempts회 안에 읽지 못하면 false
+  // (다른 프로세스의 writer가 Store 도중 종료된 경우 무한 대기 방지)
+  bool TryLoad(T &out, uint32_t max_attempts, uint64_t *out_sequence = nullptr) const noexcept {
+    return LoadImpl_(out, out_sequence, max_attempts == 0 ? 1 : max_attempts);
+  }
+
+private:
+  // max_attempts == 0: 무제한
+  bool LoadImpl_(T &out, uint64_t *out_sequence, uint32_t max_attempts) const noexcept {
+    std::array<uint64_t, kWords> words{};
+    uint64_t seq_begin = 0;
+    uint64_t seq_end = 0;
+    uint32_t attempts = 0;
+    do {
+      if (max_attempts != 0 && attempts++ == max_attempts)
+        return false;
+
+      seq_begin = seq_.load(std::memory_order_acquire);
+      if (seq_begin & 1U)
+        continue;
+
+      for (std::size_t i = 0; i < kWords; ++i)
+        words[i] = words_[i].load(std::memory_order_relaxed);
+
+      std::atomic_thread_fence(std::memory_order_acquire);
+      seq_end = seq_.load(std::memory_order_relaxed);
+    } while ((seq_begin & 1U) || seq_begin != seq_end);
+
+    if (out_sequence)
+      *out_sequence = seq_begin / 2;
+    if (seq_begin == 0)
+      return false;
+
+    std::memcpy(static_cast<void *>(&out), words.data(), sizeof(T));
+    return true;
+  }
+
+  static constexpr std::size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  std::atomic<uint64_t> seq_{0};
+  std::array<std::atomic<uint64_t>, kWords> words_{};
+};
+} // namespace loadcell_comm
+
+#endif // SEQLOCK_SLOT_H_
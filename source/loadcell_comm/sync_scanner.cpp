@@ -0,0 +1,183 @@
+#include "sync_scanner.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#define LOADCELL_SYNC_SCANNER_X86 1
+#include <immintrin.h>
+#endif
+
+namespace {
+using loadcell_comm::ScanBackend;
+using loadcell_comm::SyncPattern;
+
+std::size_t FindScalar_(const uint8_t *data, std::size_t size,
+                        const SyncPattern &pattern) noexcept {
+  if (size < pattern.size())
+    return size;
+
+  const std::size_t last = size - pattern.size();
+  for (std::size_t i = 0; i <= last; ++i) {
+    if (data[i] == pattern[0] && data[i + 1] == pattern[1] &&
+        data[i + 2] == pattern[2])
+      return i;
+  }
+  return size;
+}
+
+std::size_t FindMemchr_(const uint8_t *data, std::size_t size,
+                        const SyncPattern &pattern) noexcept {
+  if (size < pattern.size())
+    return size;
+
+  // 첫 바이트 후보만 memchr(libc SIMD)로 찾고 나머지 2바이트 비교
+  const std::size_t last = size - pattern.size();
+  std::size_t i = 0;
+  while (i <= last) {
+    const void *hit = std::memchr(data + i, pattern[0], last - i + 1);
+    if (!hit)
+      return size;
+
+    i = static_cast<std::size_t>(static_cast<const uint8_t *>(hit) - data);
+    if (data[i + 1] == pattern[1] && data[i + 2] == pattern[2])
+      return i;
+    ++i;
+  }
+  return size;
+}
+
+#if LOADCELL_SYNC_SCANNER_X86
+__attribute__((target("sse2")))
+std::size_t FindSse2_(const uint8_t *data, std::size_t size,
+                      const SyncPattern &pattern) noexcept {
+  constexpr std::size_t kLanes = 16;
+  const __m128i p0 = _mm_set1_epi8(static_cast<char>(pattern[0]));
+  const __m128i p1 = _mm_set1_epi8(static_cast<char>(pattern[1]));
+  const __m128i p2 = _mm_set1_epi8(static_cast<char>(pattern[2]));
+
+  // 시작 위치 i..i+15 를 비교하려면 i+17 까지 읽어야 함
+  std::size_t i = 0;
+  for (; i + kLanes + 2 <= size; i += kLanes) {
+    const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+    const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + 1));
+    const __m128i b2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + 2));
+    const __m128i eq = _mm_and_si128(_mm_cmpeq_epi8(b0, p0),
+                                     _mm_and_si128(_mm_cmpeq_epi8(b1, p1),
+                                                   _mm_cmpeq_epi8(b2, p2)));
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(eq));
+    if (mask != 0)
+      return i + static_cast<std::size_t>(__builtin_ctz(mask));
+  }
+
+  const std::size_t tail = FindScalar_(data + i, size - i, pattern);
+  return i + tail;
+}
+
+__attribute__((target("avx2")))
+std::size_t FindAvx2_(const uint8_t *data, std::size_t size,
+                      const SyncPattern &pattern) noexcept {
+  constexpr std::size_t kLanes = 32;
+  const __m256i p0 = _mm256_set1_epi8(static_cast<char>(pattern[0]));
+  const __m256i p1 = _mm256_set1_epi8(static_cast<char>(pattern[1]));
+  const __m256i p2 = _mm256_set1_epi8(static_cast<char>(pattern[2]));
+
+  std::size_t i = 0;
+  for (; i + kLanes + 2 <= size; i += kLanes) {
+    const __m256i b0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i));
+    const __m256i b1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i + 1));
+    const __m256i b2 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + i + 2));
+    const __m256i eq = _mm256_and_si256(_mm256_cmpeq_epi8(b0, p0),
+                                        _mm256_and_si256(_mm256_cmpeq_epi8(b1, p1),
+                                                         _mm256_cmpeq_epi8(b2, p2)));
+    const unsigned mask = static_cast<unsigned>(_mm256_movemask_epi8(eq));
+    if (mask != 0)
+      return i + static_cast<std::size_t>(__builtin_ctz(mask));
+  }
+
+  // 남은 구간은 SSE2 → scalar 순으로 처리
+  return i + FindSse2_(data + i, size - i, pattern);
+}
+#endif
+
+ScanBackend DetectBackend_() noexcept {
+#if LOADCELL_SYNC_SCANNER_X86
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return ScanBackend::kAvx2;
+  if (__builtin_cpu_supports("sse2"))
+    return ScanBackend::kSse2;
+#endif
+  return ScanBackend::kMemchr;
+}
+
+
+std::size_t Dispatch_(ScanBackend backend, const uint8_t *data, std::size_t size,
+                      const SyncPattern &pattern) noexcept {
+  switch (backend) {
+#if LOADCELL_SYNC_SCANNER_X86
+  case ScanBackend::kAvx2:
+    return FindAvx2_(data, size, pattern);
+  case ScanBackend::kSse2:
+    return FindSse2_(data, size, pattern);
+#endif
+  case ScanBackend::kMemchr:
+    return FindMemchr_(data, size, pattern);
+  case ScanBackend::kScalar:
+  default:
+    return FindScalar_(data, size, pattern);
+  }
+}
+}  // namespace
+
+namespace loadcell_comm {
+std::size_t FindSyncPattern(const uint8_t *data, std::size_t size,
+                            const SyncPattern &pattern) noexcept {
+  return Dispatch_(ActiveScanBackend(), data, size, pattern);
+}
+
+std::size_t FindSyncPatternWith(ScanBackend backend, const uint8_t *data,
+                                std::size_t size,
+                                const SyncPattern &pattern) noexcept {
+  if (!IsScanBackendSupported(backend))
+    backend = ScanBackend::kScalar;
+
+  return Dispatch_(backend, data, size, pattern);
+}
+
+bool IsScanBackendSupported(ScanBackend backend) noexcept {
+  switch (backend) {
+  case ScanBackend::kScalar:
+  case ScanBackend::kMemchr:
+    return true;
+#if LOADCELL_SYNC_SCANNER_X86
+  case ScanBackend::kSse2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2");
+  case ScanBackend::kAvx2:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+#endif
+  default:
+    return false;
+  }
+}
+
+ScanBackend ActiveScanBackend() noexcept {
+  static const ScanBackend backend = DetectBackend_();
+  return backend;
+}
+
+const char *ScanBackendName(ScanBackend backend) noexcept {
+  switch (backend) {
+  case ScanBackend::kScalar:
+    return "scalar";
+  case ScanBackend::kMemchr:
+    return "memchr";
+  case ScanBackend::kSse2:
+    return "sse2";
+  case ScanBackend::kAvx2:
+    return "avx2";
+  default:
+    return "unknown";
+  }
+}
+} // namespace loadcell_comm
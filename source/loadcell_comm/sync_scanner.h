@@ -0,0 +1,34 @@
+#ifndef SYNC_SCANNER_H_
+#define SYNC_SCANNER_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace loadcell_comm {
+// 3바이트 동기 패턴(예: 0x55 0xAB 0x01) 탐색
+// - kAvx2/kSse2: 한 번에 32/16개 시작 위치 비교 (x86, 런타임 CPU 판별)
+// - kMemchr: 첫 바이트를 memchr로 건너뛴 뒤 나머지 2바이트 비교
+// - kScalar: 모든 위치를 3바이트 비교 (기준 구현)
+enum class ScanBackend { kScalar, kMemchr, kSse2, kAvx2 };
+
+using SyncPattern = std::array<uint8_t, 3>;
+
+// 자동 선택된 구현으로 탐색
+// 반환: 패턴 전체가 일치하는 첫 위치, 없으면 size
+// (끝부분 2바이트 이하의 부분 일치는 보고하지 않음)
+std::size_t FindSyncPattern(const uint8_t *data, std::size_t size,
+                            const SyncPattern &pattern) noexcept;
+
+// 지정한 구현으로 탐색 (미지원 구현은 kScalar로 대체)
+std::size_t FindSyncPatternWith(ScanBackend backend, const uint8_t *data,
+                                std::size_t size,
+                                const SyncPattern &pattern) noexcept;
+
+bool IsScanBackendSupported(ScanBackend backend) noexcept;
+// FindSyncPattern이 사용하는 구현
+ScanBackend ActiveScanBackend() noexcept;
+const char *ScanBackendName(ScanBackend backend) noexcept;
+} // namespace loadcell_comm
+
+#endif // SYNC_SCANNER_H_
@@ -1,43 +1,54 @@
 #include "ByteRingBuffer.h"
 
 #include <algorithm>
+#include <cstring>
 #include <stdexcept>
 
-ByteRingBuffer::ByteRingBuffer(std::size_t capacity_bytes)
-    : buffer_(capacity_bytes, 0) {
+namespace {
+std::size_t RoundUpPowerOfTwo(std::size_t value) {
+    std::size_t rounded = 1;
+    while (rounded < value) {
+        rounded <<= 1;
+    }
+    return rounded;
+}
+}  // namespace
+
+ByteRingBuffer::ByteRingBuffer(std::size_t capacity_bytes) {
     if (capacity_bytes == 0) {
         throw std::invalid_argument("ByteRingBuffer 용량은 0보다 커야 합니다.");
     }
+
+    capacity_ = RoundUpPowerOfTwo(capacity_bytes);
+    mask_ = capacity_ - 1;
+    storage_ = MirroredMemory(capacity_);
 }
 
-void ByteRingBuffer::Push(const uint8_t* data, std::size_t size) {
+std::size_t ByteRingBuffer::Push(const uint8_t* data, std::size_t size) {
     if (!data || size == 0) {
-        return;
+        return 0;
     }
 
-    if (size >= buffer_.size()) {
-        data += (size - buffer_.size());
-        size = buffer_.size();
+    std::size_t dropped = 0;
+    if (size >= capacity_) {
+        dropped = size_ + (size - capacity_);
+        data += (size - capacity_);
+        size = capacity_;
         head_ = 0;
         size_ = 0;
     }
 
-    const std::size_t free_space = buffer_.size() - size_;
+    const std::size_t free_space = capacity_ - size_;
     if (size > free_space) {
+        dropped += size - free_space;
         DropFront(size - free_space);
     }
 
-    std::size_t tail = (head_ + size_) % buffer_.size();
-
-    const std::size_t first = std::min(size, buffer_.size() - tail);
-    std::copy(data, data + first, buffer_.begin() + static_cast<long>(tail));
-
-    const std::size_t remain = size - first;
-    if (remain > 0) {
-        std::copy(data + first, data + size, buffer_.begin());
-    }
+    const std::size_t tail = (head_ + size_) & mask_;
+    storage_.Write(tail, data, size);
 
     size_ += size;
+    return dropped;
 }
 
 void ByteRingBuffer::DropFront(std::size_t count) {
@@ -47,7 +58,7 @@ void ByteRingBuffer::DropFront(std::size_t count) {
         return;
     }
 
-    head_ = (head_ + count) % buffer_.size();
+    head_ = (head_ + count) & mask_;
     size_ -= count;
 }
 
@@ -55,7 +66,7 @@ uint8_t ByteRingBuffer::At(std::size_t index) const {
     if (index >= size_) {
         throw std::out_of_range("ByteRingBuffer::At 범위 초과");
     }
-    return buffer_[(head_ + index) % buffer_.size()];
+    return storage_.Data()[head_ + index];
 }
 
 std::size_t ByteRingBuffer::CopyFront(std::size_t size, std::vector<uint8_t>& out) const {
@@ -66,17 +77,29 @@ std::size_t ByteRingBuffer::CopyFront(std::size_t size, std::vector<uint8_t>& ou
         return 0;
     }
 
-    const std::size_t first = std::min(copy_size, buffer_.size() - head_);
-    std::copy(buffer_.begin() + static_cast<long>(head_),
-              buffer_.begin() + static_cast<long>(head_ + first),
-              out.begin());
+    std::memcpy(out.data(), storage_.Data() + head_, copy_size);
+    return copy_size;
+}
+
+ByteSegments ByteRingBuffer::PeekFront(std::size_t size) const noexcept {
+    ByteSegments segments;
+    const std::size_t peek_size = std::min(size, size_);
+    if (peek_size == 0) {
+        return segments;
+    }
+
+    // 미러 저장소이므로 wrap 여부와 무관하게 한 구간으로 충분
+    segments.first.data = storage_.Data() + head_;
+    segments.first.size = peek_size;
+    return segments;
+}
 
-    const std::size_t remain = copy_size - first;
-    if (remain > 0) {
-        std::copy(buffer_.begin(),
-                  buffer_.begin() + static_cast<long>(remain),
-                  out.begin() + static_cast<long>(first));
+std::size_t ByteRingBuffer::CopyOut(std::size_t offset, std::size_t size, uint8_t* out) const noexcept {
+    if (!out || offset >= size_) {
+        return 0;
     }
 
+    const std::size_t copy_size = std::min(size, size_ - offset);
+    std::memcpy(out, storage_.Data() + head_ + offset, copy_size);
     return copy_size;
 }
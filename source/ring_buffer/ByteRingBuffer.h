@@ -1,22 +1,54 @@
 #ifndef BYTE_RING_BUFFER_H_
 #define BYTE_RING_BUFFER_H_
 
+#include "MirroredMemory.h"
+
 #include <cstddef>
 #include <cstdint>
 #include <vector>
 
+/**
+ * @brief 링버퍼 내부 저장소를 가리키는 읽기 전용 연속 구간.
+ */
+struct ByteSpan {
+    const uint8_t* data = nullptr;
+    std::size_t size = 0;
+};
+
+/**
+ * @brief 링버퍼 앞쪽(oldest) 데이터를 복사 없이 노출하는 구간 쌍.
+ *
+ * - wrap이 없으면 second.size == 0 (미러 저장소 사용 시 항상 0)
+ * - 논리 인덱스 i는 i < first.size 이면 first.data[i], 아니면 second.data[i - first.size]
+ * - 버퍼에 Push/DropFront가 일어나면 무효화된다.
+ */
+struct ByteSegments {
+    ByteSpan first;
+    ByteSpan second;
+
+    std::size_t Size() const noexcept { return first.size + second.size; }
+
+    uint8_t operator[](std::size_t index) const noexcept {
+        return index < first.size ? first.data[index]
+                                  : second.data[index - first.size];
+    }
+};
+
 /**
  * @brief 고정 크기 바이트 링버퍼.
  *
  * - newest 우선 저장
  * - 용량 초과 시 oldest 데이터 자동 삭제
  * - 스트림 기반 시리얼 수신 데이터 누적용
+ * - 용량은 2의 거듭제곱 (mask 인덱싱, modulo 없음)
+ * - 저장소는 MirroredMemory: 저장된 데이터는 wrap 위치와 무관하게 항상 하나의 연속 구간
  */
 class ByteRingBuffer {
 public:
     /**
      * @brief 링버퍼 생성자.
-     * @param capacity_bytes 버퍼 용량(Byte 단위)
+     * @param capacity_bytes 버퍼 용량(Byte 단위, 2의 거듭제곱으로 올림)
+     *        페이지 크기의 배수이면 커널 이중 매핑 사용
      */
     explicit ByteRingBuffer(std::size_t capacity_bytes);
 
@@ -32,8 +64,9 @@ public:
      * @brief 바이트 데이터를 링버퍼에 추가한다.
      * @param data 입력 데이터 포인터
      * @param size 입력 데이터 크기
+     * @return 용량 초과로 삭제된 oldest 데이터 바이트 수 (기존 데이터 + 입력 앞부분)
      */
-    void Push(const uint8_t* data, std::size_t size);
+    std::size_t Push(const uint8_t* data, std::size_t size);
 
     /**
      * @brief 현재 저장된 바이트 수.
@@ -45,7 +78,18 @@ public:
      * @brief 버퍼 용량(Byte).
      * @return 용량
      */
-    std::size_t Capacity() const noexcept { return buffer_.size(); }
+    std::size_t Capacity() const noexcept { return capacity_; }
+
+    /**
+     * @brief 저장된 전체 데이터(oldest부터)를 하나의 연속 구간으로 조회한다.
+     * @return 내부 저장소를 가리키는 구간 (Push/DropFront 시 무효화)
+     */
+    ByteSpan Front() const noexcept { return ByteSpan{storage_.Data() + head_, size_}; }
+
+    /**
+     * @brief 커널 이중 매핑 사용 여부. (false면 힙 미러 복사 모드)
+     */
+    bool IsMirrored() const noexcept { return storage_.IsMapped(); }
 
     /**
      * @brief 앞쪽(oldest) 데이터 제거.
@@ -68,8 +112,26 @@ public:
      */
     std::size_t CopyFront(std::size_t size, std::vector<uint8_t>& out) const;
 
+    /**
+     * @brief 앞쪽(oldest)부터 최대 size 바이트를 복사 없이 조회한다. (버퍼에서 제거하지 않음)
+     * @param size 요청 바이트 수
+     * @return 내부 저장소를 가리키는 최대 2개의 연속 구간
+     */
+    ByteSegments PeekFront(std::size_t size) const noexcept;
+
+    /**
+     * @brief 논리 인덱스 offset부터 size 바이트를 out에 복사한다. (버퍼에서 제거하지 않음)
+     * @param offset 시작 논리 인덱스
+     * @param size 복사할 바이트 수
+     * @param out 출력 포인터(size 바이트 이상 확보되어 있어야 함)
+     * @return 실제로 복사한 바이트 수
+     */
+    std::size_t CopyOut(std::size_t offset, std::size_t size, uint8_t* out) const noexcept;
+
 private:
-    std::vector<uint8_t> buffer_;
+    MirroredMemory storage_;
+    std::size_t capacity_ = 0;
+    std::size_t mask_ = 0;
     std::size_t head_ = 0;
     std::size_t size_ = 0;
 };
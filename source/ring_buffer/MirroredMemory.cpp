@@ -0,0 +1,114 @@
+#include "MirroredMemory.h"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <unistd.h>
+
+MirroredMemory::MirroredMemory(std::size_t size) {
+    if (size == 0) {
+        throw std::invalid_argument("MirroredMemory 크기는 0보다 커야 합니다.");
+    }
+
+    size_ = size;
+    if (MapMirrored_(size)) {
+        return;
+    }
+
+    fallback_.assign(size * 2, 0);
+    base_ = fallback_.data();
+}
+
+MirroredMemory::MirroredMemory(MirroredMemory&& other) noexcept {
+    *this = std::move(other);
+}
+
+MirroredMemory& MirroredMemory::operator=(MirroredMemory&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    Release_();
+
+    base_ = other.base_;
+    size_ = other.size_;
+    mapped_ = other.mapped_;
+    fallback_ = std::move(other.fallback_);
+
+    other.base_ = nullptr;
+    other.size_ = 0;
+    other.mapped_ = false;
+    return *this;
+}
+
+MirroredMemory::~MirroredMemory() { Release_(); }
+
+void MirroredMemory::Write(std::size_t pos, const uint8_t* data, std::size_t count) noexcept {
+    if (mapped_) {
+        // 이중 매핑: 한 번의 연속 복사로 양쪽 영역이 함께 갱신됨
+        std::memcpy(base_ + pos, data, count);
+        return;
+    }
+
+    // 힙 대체 모드: [pos, pos + count) 기록 후 반대쪽 미러 영역 동기화
+    std::memcpy(base_ + pos, data, count);
+
+    const std::size_t lower = std::min(count, size_ - pos);
+    std::memcpy(base_ + pos + size_, data, lower);
+    if (count > lower) {
+        std::memcpy(base_, data + lower, count - lower);
+    }
+}
+
+bool MirroredMemory::MapMirrored_(std::size_t size) noexcept {
+    const long page_size = ::sysconf(_SC_PAGESIZE);
+    if (page_size <= 0 || size % static_cast<std::size_t>(page_size) != 0) {
+        return false;
+    }
+
+    const int fd = ::memfd_create("byte_ring_buffer", MFD_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    // 2*size 주소 공간을 먼저 예약한 뒤 앞/뒤 절반에 같은 memfd를 고정 매핑
+    void* reserved = ::mmap(nullptr, size * 2, PROT_NONE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    uint8_t* base = static_cast<uint8_t*>(reserved);
+    void* lower = ::mmap(base, size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_FIXED, fd, 0);
+    void* upper = ::mmap(base + size, size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_FIXED, fd, 0);
+    ::close(fd);
+
+    if (lower == MAP_FAILED || upper == MAP_FAILED) {
+        ::munmap(reserved, size * 2);
+        return false;
+    }
+
+    base_ = base;
+    mapped_ = true;
+    return true;
+}
+
+void MirroredMemory::Release_() noexcept {
+    if (mapped_ && base_) {
+        ::munmap(base_, size_ * 2);
+    }
+    base_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    fallback_.clear();
+    fallback_.shrink_to_fit();
+}
@@ -0,0 +1,68 @@
+#ifndef MIRRORED_MEMORY_H_
+#define MIRRORED_MEMORY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief 동일한 물리 메모리를 가상 주소 공간에 연속 2회 매핑한 버퍼.
+ *
+ * - [0, size) 와 [size, 2*size) 가 같은 메모리를 가리킴 (memfd + mmap)
+ * - 임의 위치 pos(< size)부터 size 바이트를 wrap 없이 연속 포인터로 접근 가능
+ * - size가 페이지 크기의 배수가 아니거나 memfd/mmap 실패 시
+ *   2*size 힙 버퍼 + 쓰기 시 미러 복사로 대체 (동일한 읽기 의미 보장)
+ */
+class MirroredMemory {
+public:
+    MirroredMemory() = default;
+
+    /**
+     * @brief 미러 버퍼 생성.
+     * @param size 물리 용량(Byte 단위, 0보다 커야 함)
+     */
+    explicit MirroredMemory(std::size_t size);
+
+    MirroredMemory(const MirroredMemory&) = delete;
+    MirroredMemory& operator=(const MirroredMemory&) = delete;
+
+    MirroredMemory(MirroredMemory&& other) noexcept;
+    MirroredMemory& operator=(MirroredMemory&& other) noexcept;
+
+    ~MirroredMemory();
+
+    /**
+     * @brief 매핑 시작 주소. [Data(), Data() + 2 * Size()) 읽기 가능.
+     */
+    const uint8_t* Data() const noexcept { return base_; }
+
+    /**
+     * @brief 물리 용량(Byte).
+     */
+    std::size_t Size() const noexcept { return size_; }
+
+    /**
+     * @brief 커널 이중 매핑 사용 여부. (false면 힙 대체 모드)
+     */
+    bool IsMapped() const noexcept { return mapped_; }
+
+    /**
+     * @brief pos 위치부터 데이터를 기록하고 미러 영역도 일관되게 유지한다.
+     * @param pos 시작 위치 (< Size())
+     * @param data 입력 데이터 포인터
+     * @param count 입력 크기 (<= Size())
+     */
+    void Write(std::size_t pos, const uint8_t* data, std::size_t count) noexcept;
+
+private:
+    bool MapMirrored_(std::size_t size) noexcept;
+    void Release_() noexcept;
+
+private:
+    uint8_t* base_ = nullptr;
+    std::size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<uint8_t> fallback_;
+};
+
+#endif // MIRRORED_MEMORY_H_
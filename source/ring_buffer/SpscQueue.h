@@ -0,0 +1,122 @@
+#ifndef SPSC_QUEUE_H_
+#define SPSC_QUEUE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief 고정 크기 lock-free SPSC(single-producer/single-consumer) 큐.
+ *
+ * - 생산자 스레드 1개, 소비자 스레드 1개에서만 사용
+ * - 용량은 2의 거듭제곱으로 올림 (mask 인덱싱)
+ * - 가득 찬 경우 TryPush 실패 (oldest 덮어쓰기 없음)
+ * - 생성 이후 힙 할당 없음
+ */
+template <typename T>
+class SpscQueue {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SpscQueue는 trivially copyable 타입만 지원합니다.");
+
+public:
+    /**
+     * @brief 큐 생성자.
+     * @param capacity 최소 용량(원소 개수, 2의 거듭제곱으로 올림)
+     */
+    explicit SpscQueue(std::size_t capacity) {
+        if (capacity == 0) {
+            throw std::invalid_argument("SpscQueue 용량은 0보다 커야 합니다.");
+        }
+        std::size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        slots_.resize(rounded);
+        mask_ = rounded - 1;
+    }
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    /**
+     * @brief 원소 추가. (생산자 스레드 전용)
+     * @return 큐가 가득 찬 경우 false
+     */
+    bool TryPush(const T& value) noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cached_head_ > mask_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail - cached_head_ > mask_) {
+                return false;
+            }
+        }
+        slots_[tail & mask_] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 원소 1개 꺼내기. (소비자 스레드 전용)
+     * @return 큐가 비어 있는 경우 false
+     */
+    bool TryPop(T& out) noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cached_tail_) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head == cached_tail_) {
+                return false;
+            }
+        }
+        out = slots_[head & mask_];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief 최대 max_count개를 한 번에 꺼낸다. (소비자 스레드 전용)
+     * @return 실제로 꺼낸 원소 수
+     */
+    std::size_t TryPopBulk(T* out, std::size_t max_count) noexcept {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+
+        std::size_t count = cached_tail_ - head;
+        if (count > max_count) {
+            count = max_count;
+        }
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = slots_[(head + i) & mask_];
+        }
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief 현재 원소 수(근사값, 어느 스레드에서든 호출 가능).
+     */
+    std::size_t SizeApprox() const noexcept {
+        const std::size_t tail = tail_.load(std::memory_order_acquire);
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        return tail - head;
+    }
+
+    std::size_t Capacity() const noexcept { return mask_ + 1; }
+
+private:
+    static constexpr std::size_t kCacheLineBytes = 64;
+
+    std::vector<T> slots_;
+    std::size_t mask_ = 0;
+
+    // 소비자 측 (head_ 쓰기, tail_ 캐시)
+    alignas(kCacheLineBytes) std::atomic<std::size_t> head_{0};
+    std::size_t cached_tail_ = 0;
+
+    // 생산자 측 (tail_ 쓰기, head_ 캐시)
+    alignas(kCacheLineBytes) std::atomic<std::size_t> tail_{0};
+    std::size_t cached_head_ = 0;
+};
+
+#endif // SPSC_QUEUE_H_
@@ -0,0 +1,94 @@
+#include "CaptureTap.h"
+#include "CaptureFormat.h"
+#include <cerrno>
+#include <cstring>
+#include <time.h>
+
+static std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+
+CaptureTap::CaptureTap(std::unique_ptr<ByteTransport> inner, std::string capture_path)
+    : inner_(std::move(inner)), capture_path_(std::move(capture_path)) {}
+
+CaptureTap::~CaptureTap() { Close(); }
+
+bool CaptureTap::Open() {
+  Close();
+  last_error_.clear();
+
+  if (!inner_->Open()) {
+    last_error_ = inner_->LastError();
+    return false;
+  }
+
+  file_ = std::fopen(capture_path_.c_str(), "wb");
+  if (!file_) {
+    last_error_ = SysErr("fopen");
+    inner_->Close();
+    return false;
+  }
+
+  timespec ts{};
+  ::clock_gettime(CLOCK_REALTIME, &ts);
+
+  capture_format::CaptureFileHeader header{};
+  std::memcpy(header.magic, capture_format::kMagic, sizeof(header.magic));
+  header.version = capture_format::kVersion;
+  header.byte_duration_ns = static_cast<uint32_t>(inner_->ByteDurationNs());
+  header.start_realtime_ns = static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+
+  if (std::fwrite(&header, sizeof(header), 1, file_) != 1) {
+    last_error_ = SysErr("fwrite");
+    Close();
+    return false;
+  }
+
+  capture_error_.clear();
+  return true;
+}
+
+void CaptureTap::Close() noexcept {
+  if (file_) {
+    std::fclose(file_);
+    file_ = nullptr;
+  }
+  inner_->Close();
+}
+
+long CaptureTap::Read(uint8_t *buf, std::size_t len) noexcept {
+  const long r = inner_->Read(buf, len);
+  Record_(buf, r);
+  return r;
+}
+
+long CaptureTap::ReadUntil(uint8_t *buf, std::size_t len,
+                           std::chrono::steady_clock::time_point deadline) noexcept {
+  const long r = inner_->ReadUntil(buf, len, deadline);
+  Record_(buf, r);
+  return r;
+}
+
+long CaptureTap::Write(const uint8_t *buf, std::size_t len) noexcept {
+  return inner_->Write(buf, len);
+}
+
+const std::string &CaptureTap::LastError() const noexcept {
+  return last_error_.empty() ? inner_->LastError() : last_error_;
+}
+
+void CaptureTap::Record_(const uint8_t *buf, long read_bytes) noexcept {
+  if (!file_ || read_bytes <= 0)
+    return;
+
+  capture_format::CaptureChunkHeader chunk{};
+  chunk.monotonic_ns = inner_->LastReadTime().monotonic_ns;
+  chunk.size = static_cast<uint32_t>(read_bytes);
+
+  if (std::fwrite(&chunk, sizeof(chunk), 1, file_) != 1 ||
+      std::fwrite(buf, 1, chunk.size, file_) != chunk.size) {
+    capture_error_ = SysErr("fwrite");
+    std::fclose(file_);
+    file_ = nullptr;
+  }
+}
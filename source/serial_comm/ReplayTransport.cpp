@@ -0,0 +1,188 @@
+#include "ReplayTransport.h"
+#include "CaptureFormat.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+static std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+
+static int64_t ClockNs(clockid_t clock_id) noexcept {
+  timespec ts{};
+  ::clock_gettime(clock_id, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+ReplayTransport::ReplayTransport(std::string capture_path, ReplayTiming timing)
+    : capture_path_(std::move(capture_path)), timing_(timing) {}
+
+ReplayTransport::~ReplayTransport() { Close(); }
+
+bool ReplayTransport::Open() {
+  Close();
+
+  const int fd = ::open(capture_path_.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    last_error_ = SysErr("open");
+    return false;
+  }
+
+  struct stat st {};
+  if (::fstat(fd, &st) != 0) {
+    last_error_ = SysErr("fstat");
+    ::close(fd);
+    return false;
+  }
+
+  const std::size_t size = static_cast<std::size_t>(st.st_size);
+  if (size < sizeof(capture_format::CaptureFileHeader)) {
+    last_error_ = "Open(): capture file too small";
+    ::close(fd);
+    return false;
+  }
+
+  void *mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    last_error_ = SysErr("mmap");
+    return false;
+  }
+  ::madvise(mapped, size, MADV_SEQUENTIAL);
+
+  capture_format::CaptureFileHeader header{};
+  std::memcpy(&header, mapped, sizeof(header));
+  if (std::memcmp(header.magic, capture_format::kMagic, sizeof(header.magic)) != 0 ||
+      header.version != capture_format::kVersion) {
+    last_error_ = "Open(): not a capture file (magic/version mismatch)";
+    ::munmap(mapped, size);
+    return false;
+  }
+
+  data_ = static_cast<const uint8_t *>(mapped);
+  size_ = size;
+  byte_duration_ns_ = header.byte_duration_ns;
+  Rewind();
+  return true;
+}
+
+void ReplayTransport::Close() noexcept {
+  if (data_) {
+    ::munmap(const_cast<uint8_t *>(data_), size_);
+    data_ = nullptr;
+  }
+  size_ = 0;
+  offset_ = 0;
+  chunk_data_ = nullptr;
+  chunk_remain_ = 0;
+}
+
+long ReplayTransport::Read(uint8_t *buf, std::size_t len) noexcept {
+  if (!IsOpen()) {
+    last_error_ = "Read(): transport is not open";
+    return -1;
+  }
+
+  if (chunk_remain_ == 0 && !LoadChunk_())
+    return 0;
+
+  if (timing_ == ReplayTiming::kOriginal)
+    std::this_thread::sleep_until(DueTime_());
+
+  return CopyChunk_(buf, len);
+}
+
+long ReplayTransport::ReadUntil(uint8_t *buf, std::size_t len,
+                                std::chrono::steady_clock::time_point deadline) noexcept {
+  if (!IsOpen()) {
+    last_error_ = "ReadUntil(): transport is not open";
+    return -1;
+  }
+
+  if (chunk_remain_ == 0 && !LoadChunk_())
+    return 0;
+
+  if (timing_ == ReplayTiming::kOriginal) {
+    const auto due = DueTime_();
+    if (due > deadline) {
+      std::this_thread::sleep_until(deadline);
+      return 0;
+    }
+    std::this_thread::sleep_until(due);
+  }
+
+  return CopyChunk_(buf, len);
+}
+
+long ReplayTransport::Write(const uint8_t *, std::size_t) noexcept {
+  last_error_ = "Write(): replay transport is read-only";
+  return -1;
+}
+
+bool ReplayTransport::IsEof() const noexcept {
+  return chunk_remain_ == 0 && offset_ >= size_;
+}
+
+void ReplayTransport::Rewind() noexcept {
+  offset_ = sizeof(capture_format::CaptureFileHeader);
+  chunk_data_ = nullptr;
+  chunk_remain_ = 0;
+  first_monotonic_ns_ = 0;
+  last_read_time_ = ReadTimestamp{};
+  replay_start_ = std::chrono::steady_clock::now();
+
+  if (offset_ + sizeof(capture_format::CaptureChunkHeader) <= size_) {
+    capture_format::CaptureChunkHeader chunk{};
+    std::memcpy(&chunk, data_ + offset_, sizeof(chunk));
+    first_monotonic_ns_ = chunk.monotonic_ns;
+  }
+}
+
+bool ReplayTransport::LoadChunk_() noexcept {
+  // 잘린 마지막 chunk(캡처 중단 등)는 무시
+  while (offset_ + sizeof(capture_format::CaptureChunkHeader) <= size_) {
+    capture_format::CaptureChunkHeader chunk{};
+    std::memcpy(&chunk, data_ + offset_, sizeof(chunk));
+
+    const std::size_t data_offset = offset_ + sizeof(chunk);
+    if (data_offset + chunk.size > size_)
+      break;
+
+    offset_ = data_offset + chunk.size;
+    if (chunk.size == 0)
+      continue;
+
+    chunk_data_ = data_ + data_offset;
+    chunk_remain_ = chunk.size;
+    chunk_monotonic_ns_ = chunk.monotonic_ns;
+    return true;
+  }
+
+  offset_ = size_;
+  return false;
+}
+
+std::chrono::steady_clock::time_point ReplayTransport::DueTime_() const noexcept {
+  return replay_start_ + std::chrono::nanoseconds(chunk_monotonic_ns_ - first_monotonic_ns_);
+}
+
+long ReplayTransport::CopyChunk_(uint8_t *buf, std::size_t len) noexcept {
+  const std::size_t count = std::min(len, chunk_remain_);
+  std::memcpy(buf, chunk_data_, count);
+  chunk_data_ += count;
+  chunk_remain_ -= count;
+
+  if (timing_ == ReplayTiming::kOriginal) {
+    last_read_time_.monotonic_ns = ClockNs(CLOCK_MONOTONIC);
+  } else {
+    last_read_time_.monotonic_ns = chunk_monotonic_ns_;
+  }
+
+  return static_cast<long>(count);
+}
@@ -2,9 +2,18 @@
 #include <cstdint>
 #include <string>
 
+// 커널 RS-485 송수신 방향 제어 (TIOCSRS485, 드라이버 지원 필요)
+struct Rs485Config {
+    bool enabled = false;
+    bool rts_on_send = true;              // 송신 중 RTS 레벨 (false면 송신 중 RTS low)
+    bool rx_during_tx = false;            // 송신 중 수신 허용 (로컬 에코)
+    uint32_t delay_rts_before_send_ms = 0;
+    uint32_t delay_rts_after_send_ms = 0;
+};
+
 struct SerialConfig {
     std::string device;        // e.g. "/dev/ttyUSB0"
-    int baudrate = 19200;      // e.g. 9600/19200/115200...
+    int baudrate = 19200;      // 표준 속도 외 임의 값도 가능 (termios2 BOTHER)
     uint8_t data_bits = 8;     // 5..8
     char parity = 'N';         // 'N','E','O'
     uint8_t stop_bits = 1;     // 1 or 2
@@ -15,4 +24,18 @@ struct SerialConfig {
     // VMIN/VTIME 기반: "최소 n바이트 or 타임아웃" 스타일
     uint8_t vmin = 0;          // 0이면 non-blocking-ish (VTIME에 의존)
     uint8_t vtime_ds = 1;      // deciseconds (0.1s 단위) 0..255
+
+    // O_NONBLOCK 으로 열기 (epoll 등 이벤트 루프용)
+    // true이면 Read()는 수신 데이터가 없을 때 대기하지 않고 0을 반환
+    bool non_blocking = false;
+
+    // read 반환 시각 기록: CLOCK_MONOTONIC은 항상, CLOCK_REALTIME은 true일 때만
+    bool capture_realtime = false;
+
+    // 드라이버 수신 지연 최소화 (ASYNC_LOW_LATENCY, 예: FTDI 16ms 타이머 제거)
+    // 지원하지 않는 장치면 Open() 실패
+    bool low_latency = false;
+
+    // enabled이면 커널 RS-485 모드 설정, 지원하지 않는 장치면 Open() 실패
+    Rs485Config rs485;
 };
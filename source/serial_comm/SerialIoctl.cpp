@@ -0,0 +1,87 @@
+#include "SerialIoctl.h"
+#include <asm/termbits.h>
+#include <cerrno>
+#include <cstring>
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+
+static std::string SysErr(const char *where) {
+  return std::string(where) + ": " + std::strerror(errno);
+}
+
+namespace serial_ioctl {
+bool SetArbitraryBaud(int fd, int baudrate, std::string &error) noexcept {
+  if (baudrate <= 0) {
+    error = "Unsupported baudrate";
+    return false;
+  }
+
+  struct termios2 tio2 {};
+  if (::ioctl(fd, TCGETS2, &tio2) != 0) {
+    error = SysErr("ioctl(TCGETS2)");
+    return false;
+  }
+
+  tio2.c_cflag &= ~CBAUD;
+  tio2.c_cflag |= BOTHER;
+  tio2.c_cflag &= ~(CBAUD << IBSHIFT);
+  tio2.c_cflag |= BOTHER << IBSHIFT;
+  tio2.c_ispeed = static_cast<speed_t>(baudrate);
+  tio2.c_ospeed = static_cast<speed_t>(baudrate);
+
+  if (::ioctl(fd, TCSETS2, &tio2) != 0) {
+    error = SysErr("ioctl(TCSETS2)");
+    return false;
+  }
+  return true;
+}
+
+bool GetBaud(int fd, int &out_ispeed, int &out_ospeed, std::string &error) noexcept {
+  struct termios2 tio2 {};
+  if (::ioctl(fd, TCGETS2, &tio2) != 0) {
+    error = SysErr("ioctl(TCGETS2)");
+    return false;
+  }
+
+  out_ispeed = static_cast<int>(tio2.c_ispeed);
+  out_ospeed = static_cast<int>(tio2.c_ospeed);
+  return true;
+}
+
+bool SetLowLatency(int fd, bool enable, std::string &error) noexcept {
+  serial_struct serial{};
+  if (::ioctl(fd, TIOCGSERIAL, &serial) != 0) {
+    error = SysErr("ioctl(TIOCGSERIAL)");
+    return false;
+  }
+
+  if (enable)
+    serial.flags |= ASYNC_LOW_LATENCY;
+  else
+    serial.flags &= ~ASYNC_LOW_LATENCY;
+
+  if (::ioctl(fd, TIOCSSERIAL, &serial) != 0) {
+    error = SysErr("ioctl(TIOCSSERIAL)");
+    return false;
+  }
+  return true;
+}
+
+bool SetRs485(int fd, const Rs485Config &cfg, std::string &error) noexcept {
+  serial_rs485 rs485{};
+  if (cfg.enabled) {
+    rs485.flags |= SER_RS485_ENABLED;
+    rs485.flags |= cfg.rts_on_send ? SER_RS485_RTS_ON_SEND : SER_RS485_RTS_AFTER_SEND;
+    if (cfg.rx_during_tx)
+      rs485.flags |= SER_RS485_RX_DURING_TX;
+    rs485.delay_rts_before_send = cfg.delay_rts_before_send_ms;
+    rs485.delay_rts_after_send = cfg.delay_rts_after_send_ms;
+  }
+
+  if (::ioctl(fd, TIOCSRS485, &rs485) != 0) {
+    error = SysErr("ioctl(TIOCSRS485)");
+    return false;
+  }
+  return true;
+}
+}  // namespace serial_ioctl
@@ -0,0 +1,17 @@
+#pragma once
+#include "SerialConfig.h"
+
+#include <string>
+
+// <termios.h>와 함께 포함할 수 없는 커널 헤더(asm/termbits.h)를 쓰는 설정
+// SerialPort 내부 전용 (설치하지 않음)
+namespace serial_ioctl {
+// 표준 Bxxx 상수가 없는 속도를 termios2 BOTHER로 설정 (tcsetattr 이후 호출)
+bool SetArbitraryBaud(int fd, int baudrate, std::string& error) noexcept;
+// termios2로 실제 설정된 입력/출력 속도 조회
+bool GetBaud(int fd, int& out_ispeed, int& out_ospeed, std::string& error) noexcept;
+// ASYNC_LOW_LATENCY 설정/해제 (TIOCGSERIAL/TIOCSSERIAL)
+bool SetLowLatency(int fd, bool enable, std::string& error) noexcept;
+// TIOCSRS485
+bool SetRs485(int fd, const Rs485Config& cfg, std::string& error) noexcept;
+}  // namespace serial_ioctl
@@ -1,19 +1,51 @@
 #include "SerialPort.h"
+#include "SerialIoctl.h"
 #include <cerrno>
 #include <cstring>
 #include <fcntl.h>
+#include <poll.h>
 #include <termios.h>
+#include <time.h>
 #include <unistd.h>
 
 static std::string SysErr(const char *where) {
   return std::string(where) + ": " + std::strerror(errno);
 }
 
+// 표준 Bxxx 상수, 없으면 B0 (→ termios2 BOTHER)
+static speed_t StandardSpeed(int baudrate) noexcept {
+  static constexpr struct {
+    int baudrate;
+    speed_t speed;
+  } kSpeeds[] = {
+      {1200, B1200},       {2400, B2400},       {4800, B4800},
+      {9600, B9600},       {19200, B19200},     {38400, B38400},
+      {57600, B57600},     {115200, B115200},   {230400, B230400},
+      {460800, B460800},   {500000, B500000},   {576000, B576000},
+      {921600, B921600},   {1000000, B1000000}, {1152000, B1152000},
+      {1500000, B1500000}, {2000000, B2000000}, {2500000, B2500000},
+      {3000000, B3000000}, {3500000, B3500000}, {4000000, B4000000},
+  };
+
+  for (const auto &entry : kSpeeds) {
+    if (entry.baudrate == baudrate)
+      return entry.speed;
+  }
+  return B0;
+}
+
+static int64_t ClockNs(clockid_t clock_id) noexcept {
+  timespec ts{};
+  ::clock_gettime(clock_id, &ts);
+  return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
 SerialPort::SerialPort(SerialPort &&o) noexcept {
   fd_ = o.fd_;
   o.fd_ = -1;
   config_ = std::move(o.config_);
   last_error_ = std::move(o.last_error_);
+  last_read_time_ = o.last_read_time_;
 }
 
 SerialPort &SerialPort::operator=(SerialPort &&o) noexcept {
@@ -26,6 +58,7 @@ SerialPort &SerialPort::operator=(SerialPort &&o) noexcept {
   o.fd_ = -1;
   config_ = std::move(o.config_);
   last_error_ = std::move(o.last_error_);
+  last_read_time_ = o.last_read_time_;
 
   return *this;
 }
@@ -46,7 +79,11 @@ bool SerialPort::Open() {
   if (IsOpen())
     Close();
 
-  int fd = ::open(config_->device.c_str(), O_RDWR | O_NOCTTY | O_CLOEXEC);
+  int flags = O_RDWR | O_NOCTTY | O_CLOEXEC;
+  if (config_->non_blocking)
+    flags |= O_NONBLOCK;
+
+  int fd = ::open(config_->device.c_str(), flags);
   if (fd < 0) {
     SetLastError(SysErr("open"));
     return false;
@@ -76,12 +113,90 @@ long SerialPort::Read(uint8_t *buf, std::size_t len) noexcept {
 
   ssize_t r = ::read(fd_, buf, len);
 
+  // non-blocking 모드: 수신 데이터 없음은 오류가 아님
+  if (r < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    return 0;
+
   if (r < 0)
     SetLastError(SysErr("read"));
 
+  if (r > 0) {
+    last_read_time_.monotonic_ns = ClockNs(CLOCK_MONOTONIC);
+    if (config_->capture_realtime)
+      last_read_time_.realtime_ns = ClockNs(CLOCK_REALTIME);
+  }
+
   return (long)r;
 }
 
+long SerialPort::ReadUntil(uint8_t *buf, std::size_t len,
+                           std::chrono::steady_clock::time_point deadline) noexcept {
+  if (!IsOpen()) {
+    SetLastError("ReadUntil(): port is not open");
+    return -1;
+  }
+
+  // blocking fd는 POLLIN 이후에도 VMIN 만큼 대기할 수 있어 deadline 보장 불가
+  if (!config_ || !config_->non_blocking) {
+    SetLastError("ReadUntil(): port must be opened with non_blocking");
+    return -1;
+  }
+
+  bool hang_up = false;
+  for (;;) {
+    long r = Read(buf, len);
+    if (r != 0)
+      return r;
+
+    // hang-up 통지 후에도 read가 0(EOF) → ppoll이 계속 즉시 반환하므로 기한까지 돌지 않고 실패
+    if (hang_up) {
+      SetLastError("read: EOF after device hang-up or error");
+      return -1;
+    }
+
+    const auto remain = deadline - std::chrono::steady_clock::now();
+    if (remain <= std::chrono::steady_clock::duration::zero())
+      return 0;
+
+    const auto remain_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(remain).count();
+    timespec ts{};
+    ts.tv_sec = static_cast<time_t>(remain_ns / 1000000000LL);
+    ts.tv_nsec = static_cast<long>(remain_ns % 1000000000LL);
+
+    pollfd pfd{};
+    pfd.fd = fd_;
+    pfd.events = POLLIN;
+
+    const int ready = ::ppoll(&pfd, 1, &ts, nullptr);
+    if (ready < 0) {
+      if (errno == EINTR)
+        continue;
+      SetLastError(SysErr("ppoll"));
+      return -1;
+    }
+
+    if (ready == 0)
+      return 0;
+
+    // 읽을 데이터 없이 hang-up/오류만 통지된 경우 (장치 분리 등)
+    if (!(pfd.revents & POLLIN) && (pfd.revents & (POLLHUP | POLLERR | POLLNVAL))) {
+      SetLastError("ppoll: device hang-up or error");
+      return -1;
+    }
+    hang_up = (pfd.revents & (POLLHUP | POLLERR)) != 0;
+  }
+}
+
+int64_t SerialPort::ByteDurationNs() const noexcept {
+  if (!config_ || config_->baudrate <= 0)
+    return 0;
+
+  const int bits = 1 + config_->data_bits + (config_->parity == 'N' || config_->parity == 'n' ? 0 : 1) +
+                   config_->stop_bits;
+  return static_cast<int64_t>(bits) * 1000000000LL / config_->baudrate;
+}
+
 long SerialPort::Write(const uint8_t *buf, std::size_t len) noexcept {
   if (!IsOpen()) {
     SetLastError("Write(): port is not open");
@@ -90,6 +205,10 @@ long SerialPort::Write(const uint8_t *buf, std::size_t len) noexcept {
 
   ssize_t w = ::write(fd_, buf, len);
 
+  // non-blocking 모드: 송신 큐가 가득 찬 것은 오류가 아님 (POLLOUT 대기 후 재시도)
+  if (w < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+    return 0;
+
   if (w < 0)
     SetLastError(SysErr("write"));
 
@@ -105,37 +224,88 @@ bool SerialPort::ConfigureTermios_(int fd, const SerialConfig &cfg) noexcept {
 
   ::cfmakeraw(&tio);
 
-  // baud (예: 19200만 쓸거면 더 단순화 가능)
-  speed_t sp{};
-  switch (cfg.baudrate) {
-  case 9600:
-    sp = B9600;
+  // baud: 표준 Bxxx 상수가 없으면 tcsetattr 이후 termios2 BOTHER로 설정
+  const speed_t sp = StandardSpeed(cfg.baudrate);
+  if (cfg.baudrate <= 0) {
+    SetLastError("Unsupported baudrate");
+    return false;
+  }
+  if (sp != B0 && (cfsetispeed(&tio, sp) != 0 || cfsetospeed(&tio, sp) != 0)) {
+    SetLastError(SysErr("cfsetispeed/cfsetospeed"));
+    return false;
+  }
+
+  tio.c_cflag |= (CLOCAL | CREAD);
+
+  // data bits
+  tio.c_cflag &= ~CSIZE;
+  switch (cfg.data_bits) {
+  case 5:
+    tio.c_cflag |= CS5;
+    break;
+
+  case 6:
+    tio.c_cflag |= CS6;
     break;
 
-  case 19200:
-    sp = B19200;
+  case 7:
+    tio.c_cflag |= CS7;
     break;
 
-  case 115200:
-    sp = B115200;
+  case 8:
+    tio.c_cflag |= CS8;
     break;
 
   default:
-    SetLastError("Unsupported baudrate");
+    SetLastError("Unsupported data_bits");
     return false;
   }
 
-  if (cfsetispeed(&tio, sp) != 0 || cfsetospeed(&tio, sp) != 0) {
-    SetLastError(SysErr("cfsetispeed/cfsetospeed"));
+  // parity (수신 시 parity 검사 포함)
+  tio.c_cflag &= ~(PARENB | PARODD);
+  tio.c_iflag &= ~INPCK;
+  switch (cfg.parity) {
+  case 'N':
+  case 'n':
+    break;
+
+  case 'E':
+  case 'e':
+    tio.c_cflag |= PARENB;
+    tio.c_iflag |= INPCK;
+    break;
+
+  case 'O':
+  case 'o':
+    tio.c_cflag |= PARENB | PARODD;
+    tio.c_iflag |= INPCK;
+    break;
+
+  default:
+    SetLastError("Unsupported parity");
     return false;
   }
 
-  // 8N1 기본
-  tio.c_cflag |= (CLOCAL | CREAD);
-  tio.c_cflag &= ~CSIZE;
-  tio.c_cflag |= CS8;
-  tio.c_cflag &= ~(PARENB | PARODD);
-  tio.c_cflag &= ~CSTOPB;
+  // stop bits
+  if (cfg.stop_bits == 1) {
+    tio.c_cflag &= ~CSTOPB;
+  } else if (cfg.stop_bits == 2) {
+    tio.c_cflag |= CSTOPB;
+  } else {
+    SetLastError("Unsupported stop_bits");
+    return false;
+  }
+
+  // flow control
+  if (cfg.rtscts)
+    tio.c_cflag |= CRTSCTS;
+  else
+    tio.c_cflag &= ~CRTSCTS;
+
+  if (cfg.xonxoff)
+    tio.c_iflag |= (IXON | IXOFF);
+  else
+    tio.c_iflag &= ~(IXON | IXOFF | IXANY);
 
   // VMIN/VTIME
   tio.c_cc[VMIN] = cfg.vmin;
@@ -145,7 +315,23 @@ bool SerialPort::ConfigureTermios_(int fd, const SerialConfig &cfg) noexcept {
     SetLastError(SysErr("tcsetattr"));
     return false;
   }
-  
+
+  std::string error;
+  if (sp == B0 && !serial_ioctl::SetArbitraryBaud(fd, cfg.baudrate, error)) {
+    SetLastError(std::move(error));
+    return false;
+  }
+
+  if (cfg.low_latency && !serial_ioctl::SetLowLatency(fd, true, error)) {
+    SetLastError(std::move(error));
+    return false;
+  }
+
+  if (cfg.rs485.enabled && !serial_ioctl::SetRs485(fd, cfg.rs485, error)) {
+    SetLastError(std::move(error));
+    return false;
+  }
+
   ::tcflush(fd, TCIFLUSH);
   return true;
 }
@@ -1,12 +1,14 @@
 #pragma once
+#include "ByteTransport.h"
 #include "SerialConfig.h"
 
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <optional>
 #include <string>
 
-class SerialPort {
+class SerialPort : public ByteTransport {
 public:
     SerialPort() = default;
     explicit SerialPort(SerialConfig cfg) : config_(std::move(cfg)) {}
@@ -17,28 +19,40 @@ public:
     SerialPort(SerialPort&&) noexcept;
     SerialPort& operator=(SerialPort&&) noexcept;
 
-    virtual ~SerialPort(); // RAII: Close()
+    ~SerialPort() override; // RAII: Close()
 
     bool Open(const SerialConfig& cfg);
-    bool Open();
+    bool Open() override;
 
-    void Close() noexcept;
-    bool IsOpen() const noexcept { return fd_ >= 0; }
+    void Close() noexcept override;
+    bool IsOpen() const noexcept override { return fd_ >= 0; }
+    int Fd() const noexcept override { return fd_; }
 
-    long Read(uint8_t* buf, std::size_t len) noexcept;
-    long Write(const uint8_t* buf, std::size_t len) noexcept;
+    long Read(uint8_t* buf, std::size_t len) noexcept override;
+    // ppoll 기반 마이크로초 단위 타임아웃 read (non_blocking 모드 전용)
+    // 반환: 읽은 바이트 수, 타임아웃 시 0, 오류 또는 hang-up 후 EOF 시 -1
+    // (ReadFor는 ByteTransport 제공)
+    long ReadUntil(uint8_t* buf, std::size_t len,
+                   std::chrono::steady_clock::time_point deadline) noexcept override;
+    long Write(const uint8_t* buf, std::size_t len) noexcept override;
+
+    // start bit + data bits + parity bit + stop bits 기준
+    int64_t ByteDurationNs() const noexcept override;
+
+    // 마지막으로 데이터를 읽은 Read() 반환 시각
+    const ReadTimestamp& LastReadTime() const noexcept override { return last_read_time_; }
 
     const std::optional<SerialConfig>& Config() const noexcept { return config_; }
-    const std::string& LastError() const noexcept { return last_error_; }
+    const std::string& LastError() const noexcept override { return last_error_; }
 
 protected:
-    int Fd() const noexcept { return fd_; }
     void SetLastError(std::string msg) noexcept { last_error_ = std::move(msg); }
 
 private:
     int fd_ = -1;
     std::optional<SerialConfig> config_;
     std::string last_error_;
+    ReadTimestamp last_read_time_;
 
     bool ConfigureTermios_(int fd, const SerialConfig& cfg) noexcept;
 };